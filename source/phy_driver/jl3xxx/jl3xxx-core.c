@@ -14,6 +14,45 @@
 #include "jl3xxx-core.h"
 #include <linux/phy.h>
 #include <linux/of.h>
+#if (JL3XXX_MDIO_ACCT)
+#include <linux/debugfs.h>
+#include <linux/seq_file.h>
+#include <linux/ktime.h>
+
+static int jl3xxx_read_mmd(struct phy_device *phydev, int devad, u16 reg)
+{
+	struct jl3xxx_priv *priv = phydev->priv;
+	u64 start = ktime_to_ns(ktime_get());
+	int val;
+
+	val = phy_read_mmd(phydev, devad, reg);
+	if (priv) {
+		priv->acct.reads++;
+		priv->acct.ns += ktime_to_ns(ktime_get()) - start;
+	}
+
+	return val;
+}
+
+static int jl3xxx_write_mmd(struct phy_device *phydev,
+			    int devad, u16 reg, u16 val)
+{
+	struct jl3xxx_priv *priv = phydev->priv;
+	u64 start = ktime_to_ns(ktime_get());
+	int ret;
+
+	ret = phy_write_mmd(phydev, devad, reg, val);
+	if (priv) {
+		priv->acct.writes++;
+		priv->acct.ns += ktime_to_ns(ktime_get()) - start;
+	}
+
+	return ret;
+}
+#else
+#define jl3xxx_read_mmd		phy_read_mmd
+#define jl3xxx_write_mmd	phy_write_mmd
+#endif
 
 enum jl3xxx_mode get_device_mode(struct device *dev)
 {
@@ -54,7 +93,7 @@ int jl3xxx_mmd_modify(struct phy_device *phydev,
 {
 	int old, val, ret;
 
-	old = phy_read_mmd(phydev, devad, reg);
+	old = jl3xxx_read_mmd(phydev, devad, reg);
 	if (old < 0)
 		return old;
 
@@ -62,7 +101,7 @@ int jl3xxx_mmd_modify(struct phy_device *phydev,
 	if (val == old)
 		return 0;
 
-	ret = phy_write_mmd(phydev, devad, reg, val);
+	ret = jl3xxx_write_mmd(phydev, devad, reg, val);
 
 	return ret < 0 ? ret : 1;
 }
@@ -73,7 +112,7 @@ int jl3xxx_fetch_mmd_bit(struct phy_device *phydev,
 {
 	int val;
 
-	val = phy_read_mmd(phydev, devad, reg);
+	val = jl3xxx_read_mmd(phydev, devad, reg);
 	if (val < 0)
 		return val;
 
@@ -167,3 +206,81 @@ int jl3xxx_config_phy_status(struct phy_device *phydev,
 	return 0;
 }
 EXPORT_SYMBOL_GPL(jl3xxx_config_phy_status);
+
+#if (JL3XXX_MDIO_ACCT)
+static struct dentry *jl3xxx_debugfs_root;
+static int jl3xxx_debugfs_users;
+static DEFINE_MUTEX(jl3xxx_debugfs_lock);
+
+static int jl3xxx_acct_show(struct seq_file *m, void *v)
+{
+	struct phy_device *phydev = m->private;
+	struct jl3xxx_priv *priv = phydev->priv;
+
+	seq_printf(m, "reads:  %llu\n", priv->acct.reads);
+	seq_printf(m, "writes: %llu\n", priv->acct.writes);
+	seq_printf(m, "ns:     %llu\n", priv->acct.ns);
+
+	return 0;
+}
+
+static int jl3xxx_acct_open(struct inode *inode, struct file *file)
+{
+	return single_open(file, jl3xxx_acct_show, inode->i_private);
+}
+
+static const struct file_operations jl3xxx_acct_fops = {
+	.owner		= THIS_MODULE,
+	.open		= jl3xxx_acct_open,
+	.read		= seq_read,
+	.llseek		= seq_lseek,
+	.release	= single_release,
+};
+
+static int jl3xxx_acct_reset(void *data, u64 val)
+{
+	struct phy_device *phydev = data;
+	struct jl3xxx_priv *priv = phydev->priv;
+
+	memset(&priv->acct, 0, sizeof(priv->acct));
+
+	return 0;
+}
+
+DEFINE_SIMPLE_ATTRIBUTE(jl3xxx_acct_reset_fops, NULL, jl3xxx_acct_reset,
+			"%llu\n");
+
+void jl3xxx_debugfs_init(struct phy_device *phydev)
+{
+	struct jl3xxx_priv *priv = phydev->priv;
+
+	mutex_lock(&jl3xxx_debugfs_lock);
+	if (!jl3xxx_debugfs_users++)
+		jl3xxx_debugfs_root = debugfs_create_dir("jl3xxx", NULL);
+	priv->debugfs = debugfs_create_dir(dev_name(&phydev->mdio.dev),
+					   jl3xxx_debugfs_root);
+	mutex_unlock(&jl3xxx_debugfs_lock);
+
+	debugfs_create_file("mdio", S_IRUGO, priv->debugfs, phydev,
+			    &jl3xxx_acct_fops);
+	debugfs_create_file("mdio_reset", S_IWUSR, priv->debugfs, phydev,
+			    &jl3xxx_acct_reset_fops);
+}
+EXPORT_SYMBOL_GPL(jl3xxx_debugfs_init);
+
+void jl3xxx_debugfs_exit(struct phy_device *phydev)
+{
+	struct jl3xxx_priv *priv = phydev->priv;
+
+	debugfs_remove_recursive(priv->debugfs);
+	priv->debugfs = NULL;
+
+	mutex_lock(&jl3xxx_debugfs_lock);
+	if (!--jl3xxx_debugfs_users) {
+		debugfs_remove_recursive(jl3xxx_debugfs_root);
+		jl3xxx_debugfs_root = NULL;
+	}
+	mutex_unlock(&jl3xxx_debugfs_lock);
+}
+EXPORT_SYMBOL_GPL(jl3xxx_debugfs_exit);
+#endif
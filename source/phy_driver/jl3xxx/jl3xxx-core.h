@@ -23,6 +23,13 @@
 #include <linux/delay.h>
 #include <linux/phy.h>
 
+/* Count the mmd cycles issued by the driver, see debugfs "jl3xxx/<phy>".
+ * Can be switched on from the build with "make MDIO_ACCT=1".
+ */
+#ifndef JL3XXX_MDIO_ACCT
+#define JL3XXX_MDIO_ACCT	0
+#endif
+
 #define JL3XXX_UNKNOWN		0x0000
 #define JL3XXX_100BASE_T1	0x0001
 #define JL3XXX_1000BASE_T1	0x0002
@@ -61,9 +68,19 @@ enum jl3xxx_speed {
 	PHY_SPEED_1000M,
 };
 
+struct jl3xxx_mdio_acct {
+	u64 reads;
+	u64 writes;
+	u64 ns;
+};
+
 struct jl3xxx_priv {
 	enum jl3xxx_mode device_mode;
 	enum jl3xxx_speed device_speed;
+#if (JL3XXX_MDIO_ACCT)
+	struct jl3xxx_mdio_acct acct;
+	struct dentry *debugfs;
+#endif
 };
 
 static const char *const jl3xxx_modes[] = {
@@ -106,4 +123,18 @@ int jl3xxx_get_speed(struct phy_device *phydev);
 
 int jl3xxx_set_tx_dly(struct phy_device *phydev);
 
+#if (JL3XXX_MDIO_ACCT)
+void jl3xxx_debugfs_init(struct phy_device *phydev);
+
+void jl3xxx_debugfs_exit(struct phy_device *phydev);
+#else
+static inline void jl3xxx_debugfs_init(struct phy_device *phydev)
+{
+}
+
+static inline void jl3xxx_debugfs_exit(struct phy_device *phydev)
+{
+}
+#endif
+
 #endif
@@ -97,9 +97,17 @@ static int jl3xxx_probe(struct phy_device *phydev)
 
 	dev_info(&phydev->mdio.dev, "phy_id: 0x%x\n", id);
 
+	jl3xxx_debugfs_init(phydev);
+
 	return 0;
 }
 
+static void jl3xxx_remove(struct phy_device *phydev)
+{
+	if (phydev->priv)
+		jl3xxx_debugfs_exit(phydev);
+}
+
 static int jl3xxx_read_status(struct phy_device *phydev)
 {
 	int speed;
@@ -137,6 +145,7 @@ static struct phy_driver jl3xxx_driver[] = {
 	.flags		= PHY_POLL,
 	.soft_reset	= jl3xxx_soft_reset,
 	.probe		= jl3xxx_probe,
+	.remove		= jl3xxx_remove,
 	.config_init	= jl3xxx_config_init,
 	.config_aneg	= jl3xxx_config_aneg,
 	.aneg_done	= jl3xxx_aneg_done,
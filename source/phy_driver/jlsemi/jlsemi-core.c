@@ -17,6 +17,20 @@
 #include <linux/module.h>
 #include <linux/version.h>
 #include <linux/netdevice.h>
+#include <linux/delay.h>
+#include <linux/jiffies.h>
+#include <linux/firmware.h>
+#include <linux/slab.h>
+#include <linux/sort.h>
+#include <linux/bsearch.h>
+#include <linux/list.h>
+#include <linux/mutex.h>
+#include <linux/debugfs.h>
+#include <linux/seq_file.h>
+#include <linux/interrupt.h>
+
+#define CREATE_TRACE_POINTS
+#include "jlsemi-trace.h"
 
 #define JL1XXX_PAGE24		24
 #define JL1XXX_LED_BLINK_REG	25
@@ -56,8 +70,6 @@
 #define JL2XXX_BMCR_SPEED_MSB	BIT(6)
 #define JL2XXX_BMCR_AN_RESTART	BIT(9)
 
-
-
 #define JL2XXX_SUPP_LED_MODE	(JL2XXX_LED0_LINK10 | \
 				 JL2XXX_LED0_LINK100 | \
 				 JL2XXX_LED0_LINK1000 | \
@@ -88,102 +100,139 @@
 				 JL1XXX_LED1_10_LINK)
 
 /************************* Configuration section *************************/
+static const struct jl_reg_field jl1xxx_led_period =
+	JLSEMI_REG_FIELD(JL1XXX_PAGE24, JL1XXX_LED_BLINK_REG,
+			 LED_PERIOD_MASK, 8);
+static const struct jl_reg_field jl1xxx_led_on =
+	JLSEMI_REG_FIELD(JL1XXX_PAGE24, JL1XXX_LED_BLINK_REG,
+			 LED_ON_MASK, 0);
+static const struct jl_reg_field jl1xxx_mdi_amplitude =
+	JLSEMI_REG_FIELD(JL1XXX_PAGE24, JL1XXX_REG24,
+			 JL1XXX_MDI_TX_BM_MASK, 10);
+static const struct jl_reg_field jl1xxx_rmii_mode =
+	JLSEMI_REG_FIELD(JL1XXX_PAGE7, JL1XXX_REG16,
+			 JL1XXX_RMII_MODE, 3);
+static const struct jl_reg_field jl1xxx_rmii_clk_50m_input =
+	JLSEMI_REG_FIELD(JL1XXX_PAGE7, JL1XXX_REG16,
+			 JL1XXX_RMII_CLK_50M_INPUT, 12);
+static const struct jl_reg_field jl1xxx_rmii_crs_dv =
+	JLSEMI_REG_FIELD(JL1XXX_PAGE7, JL1XXX_REG16,
+			 JL1XXX_RMII_CRS_DV, 2);
+static const struct jl_reg_field jl1xxx_rmii_tx_skew =
+	JLSEMI_REG_FIELD(JL1XXX_PAGE7, JL1XXX_REG16,
+			 JL1XXX_RMII_TX_SKEW_MASK, 8);
+static const struct jl_reg_field jl1xxx_rmii_rx_skew =
+	JLSEMI_REG_FIELD(JL1XXX_PAGE7, JL1XXX_REG16,
+			 JL1XXX_RMII_RX_SKEW_MASK, 4);
+
+/* Static configuration registers, they only change when the driver
+ * writes them. The index in the table is the slot in jl_core_ctrl regs.
+ */
+static const struct jl_reg_key jl1xxx_cached_regs[] = {
+	{ JL1XXX_PAGE7, JL1XXX_LED_REG },
+	{ JL1XXX_PAGE7, JL1XXX_REG16 },
+	{ JL1XXX_PAGE24, JL1XXX_REG24 },
+	{ JL1XXX_PAGE24, JL1XXX_LED_BLINK_REG },
+	{ JL1XXX_PAGE128, JL1XXX_LED_GPIO_REG },
+	{ JL1XXX_PAGE129, JL1XXX_LED_MODE_REG },
+};
+
+/* Registers updated by the phy itself, never cached */
+static const struct jl_reg_key jl1xxx_volatile_regs[] = {
+	{ JL1XXX_PAGE0, MII_BMCR },
+	{ JL1XXX_PAGE0, MII_BMSR },
+	{ JL1XXX_PAGE0, JL1XXX_INTR_STATUS_REG },
+	{ JL1XXX_PAGE129, JL1XXX_WOL_CTRL_REG },
+};
+
+static const struct jl_reg_key jl2xxx_cached_regs[] = {
+	{ JL2XXX_PAGE3332, JL2XXX_LED_CTRL_REG },
+	{ JL2XXX_PAGE4096, JL2XXX_LED_POLARITY_REG },
+	{ JL2XXX_PAGE4096, JL2XXX_LED_BLINK_REG },
+	{ JL2XXX_PAGE3336, JL2XXX_RGMII_CTRL_REG },
+	{ JL2XXX_PAGE2627, JL2XXX_CLK_CTRL_REG },
+	{ JL2XXX_PAGE128, JL2XXX_FLD_CTRL_REG },
+	{ JL2XXX_PAGE258, JL2XXX_SLEW_RATE_CTRL_REG },
+};
 
+static const struct jl_reg_key jl2xxx_volatile_regs[] = {
+	{ JL2XXX_PAGE0, MII_BMCR },
+	{ JL2XXX_PAGE0, MII_BMSR },
+	{ JL2XXX_PAGE2627, JL2XXX_INTR_STATUS_REG },
+	{ JL2XXX_WOL_STAS_PAGE, JL2XXX_WOL_STAS_REG },
+	/* Also the WOL control register, the work mode bits are live */
+	{ JL2XXX_PAGE18, JL2XXX_WORK_MODE_REG },
+};
+
+static const struct jl_reg_field jl2xxx_led_period =
+	JLSEMI_REG_FIELD(JL2XXX_PAGE4096, JL2XXX_LED_BLINK_REG,
+			 LED_PERIOD_MASK, 8);
+static const struct jl_reg_field jl2xxx_led_on =
+	JLSEMI_REG_FIELD(JL2XXX_PAGE4096, JL2XXX_LED_BLINK_REG,
+			 LED_ON_MASK, 0);
+static const struct jl_reg_field jl2xxx_fld_delay =
+	JLSEMI_REG_FIELD(JL2XXX_PAGE128, JL2XXX_FLD_CTRL_REG,
+			 JL2XXX_FLD_MASK, JL2XXX_FLD_MASK_HEAD);
+static const struct jl_reg_field jl2xxx_fld_en =
+	JLSEMI_REG_FIELD(JL2XXX_PAGE128, JL2XXX_FLD_CTRL_REG,
+			 JL2XXX_FLD_EN, 13);
 
 /************************* JLSemi iteration code *************************/
-static int jl1xxx_led_static_op_set(struct phy_device *phydev)
+static void jl1xxx_led_static_op_build(struct phy_device *phydev,
+				       struct jl_reg_txn *txn)
 {
 	struct jl1xxx_priv *priv = phydev->priv;
-	int err;
 
 	/* Enable LED operation */
-	jlsemi_set_bits(phydev, JL1XXX_PAGE7,
-			JL1XXX_LED_REG, JL1XXX_LED_EN);
+	jlsemi_txn_set_bits(txn, JL1XXX_PAGE7,
+			    JL1XXX_LED_REG, JL1XXX_LED_EN);
 
 	/* Set led mode */
-	if (priv->led.enable & JL1XXX_LED_MODE_EN) {
-		err = jlsemi_modify_paged_reg(phydev, JL1XXX_PAGE129,
-					      JL1XXX_LED_MODE_REG,
-					      JL1XXX_SUPP_LED_MODE,
-					      priv->led.mode);
-		if (err < 0)
-			return err;
-	}
+	if (priv->led.enable & JL1XXX_LED_MODE_EN)
+		jlsemi_txn_modify(txn, JL1XXX_PAGE129,
+				  JL1XXX_LED_MODE_REG,
+				  JL1XXX_SUPP_LED_MODE,
+				  priv->led.mode);
 	/* Set led period */
-	if (priv->led.enable & JL1XXX_LED_GLOABL_PERIOD_EN) {
-		err = jlsemi_modify_paged_reg(phydev, JL1XXX_PAGE24,
-					      JL1XXX_LED_BLINK_REG,
-					      LED_PERIOD_MASK,
-					      LEDPERIOD(
-					      priv->led.global_period));
-		if (err < 0)
-			return err;
-	}
+	if (priv->led.enable & JL1XXX_LED_GLOABL_PERIOD_EN)
+		jlsemi_txn_field(txn, &jl1xxx_led_period,
+				 priv->led.global_period);
 	/* Set led on time */
-	if (priv->led.enable & JL1XXX_LED_GLOBAL_ON_EN) {
-		err = jlsemi_modify_paged_reg(phydev, JL1XXX_PAGE24,
-					      JL1XXX_LED_BLINK_REG,
-					      LED_ON_MASK,
-					      LEDON(priv->led.global_on));
-		if (err < 0)
-			return err;
-	}
+	if (priv->led.enable & JL1XXX_LED_GLOBAL_ON_EN)
+		jlsemi_txn_field(txn, &jl1xxx_led_on,
+				 priv->led.global_on);
 	/*Set led gpio output */
-	if (priv->led.enable & JL1XXX_LED_GPIO_OUT_EN) {
-		err = jlsemi_modify_paged_reg(phydev, JL1XXX_PAGE128,
-					      JL1XXX_LED_GPIO_REG,
-					      JL1XXX_SUPP_GPIO,
-					      priv->led.gpio_output);
-		if (err < 0)
-			return err;
-	}
-
-	return 0;
+	if (priv->led.enable & JL1XXX_LED_GPIO_OUT_EN)
+		jlsemi_txn_modify(txn, JL1XXX_PAGE128,
+				  JL1XXX_LED_GPIO_REG,
+				  JL1XXX_SUPP_GPIO,
+				  priv->led.gpio_output);
 }
 
-static int jl2xxx_led_static_op_set(struct phy_device *phydev)
+static void jl2xxx_led_static_op_build(struct phy_device *phydev,
+				       struct jl_reg_txn *txn)
 {
 	struct jl2xxx_priv *priv = phydev->priv;
-	int err;
 
 	/* Set led mode */
-	if (priv->led.enable & JL2XXX_LED_MODE_EN) {
-		err = jlsemi_modify_paged_reg(phydev, JL2XXX_PAGE3332,
-					      JL2XXX_LED_CTRL_REG,
-					      JL2XXX_SUPP_LED_MODE,
-					      priv->led.mode);
-		if (err < 0)
-			return err;
-	}
+	if (priv->led.enable & JL2XXX_LED_MODE_EN)
+		jlsemi_txn_modify(txn, JL2XXX_PAGE3332,
+				  JL2XXX_LED_CTRL_REG,
+				  JL2XXX_SUPP_LED_MODE,
+				  priv->led.mode);
 	/* Set led period */
-	if (priv->led.enable & JL2XXX_LED_GLOABL_PERIOD_EN) {
-		err = jlsemi_modify_paged_reg(phydev, JL2XXX_PAGE4096,
-					      JL2XXX_LED_BLINK_REG,
-					      LED_PERIOD_MASK,
-					      LEDPERIOD(
-					      priv->led.global_period));
-		if (err < 0)
-			return err;
-	}
+	if (priv->led.enable & JL2XXX_LED_GLOABL_PERIOD_EN)
+		jlsemi_txn_field(txn, &jl2xxx_led_period,
+				 priv->led.global_period);
 	/* Set led on time */
-	if (priv->led.enable & JL2XXX_LED_GLOBAL_ON_EN) {
-		err = jlsemi_modify_paged_reg(phydev, JL2XXX_PAGE4096,
-					      JL2XXX_LED_BLINK_REG,
-					      LED_ON_MASK,
-					      LEDON(priv->led.global_on));
-		if (err < 0)
-			return err;
-	}
+	if (priv->led.enable & JL2XXX_LED_GLOBAL_ON_EN)
+		jlsemi_txn_field(txn, &jl2xxx_led_on,
+				 priv->led.global_on);
 	/* Set led polarity */
-	if (priv->led.enable & JL2XXX_LED_POLARITY_EN) {
-		err = jlsemi_set_bits(phydev, JL2XXX_PAGE4096,
-				      JL2XXX_LED_POLARITY_REG,
-				      priv->led.polarity);
-		if (err < 0)
-			return err;
-	}
-
-	return 0;
+	if (priv->led.enable & JL2XXX_LED_POLARITY_EN)
+		jlsemi_txn_set_bits(txn, JL2XXX_PAGE4096,
+				    JL2XXX_LED_POLARITY_REG,
+				    priv->led.polarity);
 }
 
 struct device *jlsemi_get_mdio(struct phy_device *phydev)
@@ -196,6 +245,48 @@ struct device *jlsemi_get_mdio(struct phy_device *phydev)
 	return dev;
 }
 
+static inline const char *jlsemi_trace_dev(struct phy_device *phydev)
+{
+	return dev_name(jlsemi_get_mdio(phydev));
+}
+
+static struct jl_core_ctrl *jlsemi_core_ctrl(struct phy_device *phydev)
+{
+	if (!phydev->priv)
+		return NULL;
+
+	if ((phydev->phy_id & JLSEMI_PHY_ID_MASK) ==
+	    (JL1XXX_PHY_ID & JLSEMI_PHY_ID_MASK))
+		return &((struct jl1xxx_priv *)phydev->priv)->core;
+
+	return &((struct jl2xxx_priv *)phydev->priv)->core;
+}
+
+/**
+ * jlsemi_irq_setup() - Choose between interrupt and polling mode
+ * @phydev: a pointer to a &struct phy_device
+ * @enable: interrupt is enabled in the phy configuration
+ * @irq: fallback irq number from JL1XXX_INTR_IRQ or JL2XXX_INTR_IRQ
+ *
+ * Note:
+ * the irq that of_mdio mapped from the "interrupts" property of the
+ * phy node wins, the macro is only used for boards without one. A phy
+ * whose interrupt pin is not configured must be polled even if the
+ * device tree wires it up.
+ *
+ */
+void jlsemi_irq_setup(struct phy_device *phydev, bool enable, int irq)
+{
+	if (!enable) {
+		if (phydev->irq > 0)
+			phydev->irq = PHY_POLL;
+		return;
+	}
+
+	if (phydev->irq == PHY_POLL && irq > 0)
+		phydev->irq = irq;
+}
+
 static struct device_node *get_device_node(struct phy_device *phydev)
 {
 	struct device *dev = jlsemi_get_mdio(phydev);
@@ -240,6 +331,8 @@ static int jl1xxx_dts_intr_cfg_get(struct phy_device *phydev)
 
 	of_property_read_u32(of_node, "jl1xxx,interrupt-enable",
 			     &priv->intr.enable);
+	of_property_read_u32(of_node, "jl1xxx,interrupt-coalesce",
+			     &priv->intr.coalesce);
 
 	return 0;
 }
@@ -331,6 +424,7 @@ static int jl1xxx_c_macro_intr_cfg_get(struct phy_device *phydev)
 
 	struct jl_intr_ctrl intr_cfg = {
 		.enable		= JL1XXX_INTR_CTRL_EN,
+		.coalesce	= JL1XXX_INTR_COALESCE_MS,
 	};
 
 	priv->intr = intr_cfg;
@@ -401,6 +495,8 @@ static int jl1xxx_wol_operation_args(struct phy_device *phydev)
 	return 0;
 }
 
+static void jlsemi_intr_storm_work(struct work_struct *work);
+
 static int jl1xxx_intr_operation_args(struct phy_device *phydev)
 {
 	struct jl1xxx_priv *priv = phydev->priv;
@@ -414,6 +510,16 @@ static int jl1xxx_intr_operation_args(struct phy_device *phydev)
 	/* Not supported by default */
 	intr->ethtool = false;
 
+	intr->phydev = phydev;
+	intr->page = JL1XXX_PAGE0;
+	intr->reg = JL1XXX_INTR_STATUS_REG;
+	intr->ctrl_page = JL1XXX_PAGE7;
+	intr->ctrl_reg = JL1XXX_INTR_REG;
+	intr->sources = JL1XXX_INTR_LINK | JL1XXX_INTR_AN_ERR;
+	intr->mask = jl1xxx_intr_mask(phydev);
+	intr->link = intr->sources;
+	INIT_DELAYED_WORK(&intr->storm_work, jlsemi_intr_storm_work);
+
 	return 0;
 }
 
@@ -513,6 +619,8 @@ static int jl2xxx_dts_intr_cfg_get(struct phy_device *phydev)
 
 	of_property_read_u32(of_node, "jl2xxx,interrupt-enable",
 			     &priv->intr.enable);
+	of_property_read_u32(of_node, "jl2xxx,interrupt-coalesce",
+			     &priv->intr.coalesce);
 
 	return 0;
 }
@@ -615,6 +723,17 @@ static int jl2xxx_dts_rxc_out_cfg_get(struct phy_device *phydev)
 	return 0;
 }
 
+static int jl2xxx_dts_async_init_cfg_get(struct phy_device *phydev)
+{
+	struct jl2xxx_priv *priv = phydev->priv;
+	struct device_node *of_node = get_device_node(phydev);
+
+	of_property_read_u32(of_node, "jl2xxx,async_init-enable",
+			     &priv->async_init.enable);
+
+	return 0;
+}
+
 static int jl2xxx_c_macro_fld_cfg_get(struct phy_device *phydev)
 {
 	struct jl2xxx_priv *priv = phydev->priv;
@@ -648,6 +767,7 @@ static int jl2xxx_c_macro_intr_cfg_get(struct phy_device *phydev)
 
 	struct jl_intr_ctrl intr_cfg = {
 		.enable		= JL2XXX_INTR_CTRL_EN,
+		.coalesce	= JL2XXX_INTR_COALESCE_MS,
 	};
 
 	priv->intr = intr_cfg;
@@ -764,6 +884,19 @@ static int jl2xxx_c_macro_rxc_out_cfg_get(struct phy_device *phydev)
 	return 0;
 }
 
+static int jl2xxx_c_macro_async_init_cfg_get(struct phy_device *phydev)
+{
+	struct jl2xxx_priv *priv = phydev->priv;
+
+	struct jl_async_init_ctrl async_init_cfg = {
+		.enable		= JL2XXX_ASYNC_INIT_CTRL_EN,
+	};
+
+	priv->async_init = async_init_cfg;
+
+	return 0;
+}
+
 static int jl2xxx_fld_operation_args(struct phy_device *phydev)
 {
 	struct jl2xxx_priv *priv = phydev->priv;
@@ -809,6 +942,19 @@ static int jl2xxx_intr_operation_args(struct phy_device *phydev)
 	/* Not supported by default */
 	intr->ethtool = false;
 
+	intr->phydev = phydev;
+	intr->page = JL2XXX_PAGE2627;
+	intr->reg = JL2XXX_INTR_STATUS_REG;
+	intr->ctrl_page = JL2XXX_PAGE2626;
+	intr->ctrl_reg = JL2XXX_INTR_CTRL_REG;
+	intr->sources = JL2XXX_INTR_LINK_CHANGE | JL2XXX_INTR_AN_COMPLETE |
+			JL2XXX_INTR_AN_PAGE | JL2XXX_INTR_AN_ERR;
+	intr->mask = jl2xxx_intr_mask(phydev);
+	/* A received page alone does not change the link */
+	intr->link = JL2XXX_INTR_LINK_CHANGE | JL2XXX_INTR_AN_COMPLETE |
+		     JL2XXX_INTR_AN_ERR;
+	INIT_DELAYED_WORK(&intr->storm_work, jlsemi_intr_storm_work);
+
 	return 0;
 }
 
@@ -940,20 +1086,61 @@ static int jl2xxx_rxc_out_operation_args(struct phy_device *phydev)
 	return 0;
 }
 
-static int jl2xxx_fld_static_op_set(struct phy_device *phydev)
+static void jl2xxx_async_init_work(struct work_struct *work);
+
+static int jl2xxx_async_init_operation_args(struct phy_device *phydev)
 {
 	struct jl2xxx_priv *priv = phydev->priv;
-	int err;
-	u8 val;
+	struct jl_async_init_ctrl *async_init = &priv->async_init;
 
-	val = priv->fld.delay & 0xff;
-	err = jl2xxx_fld_dynamic_op_set(phydev, &val);
-	if (err < 0)
-		return err;
+	if (JLSEMI_KERNEL_DEVICE_TREE_USE)
+		jl2xxx_dts_async_init_cfg_get(phydev);
+	else
+		jl2xxx_c_macro_async_init_cfg_get(phydev);
+
+	INIT_WORK(&async_init->work, jl2xxx_async_init_work);
+	async_init->phydev = phydev;
+	atomic_set(&async_init->pending, 0);
+	async_init->err = 0;
+	async_init->aneg = false;
+	/* Not supported by default */
+	async_init->ethtool = false;
 
 	return 0;
 }
 
+/* Queue a fast link down setting, @msecs as for ETHTOOL_PHY_FAST_LINK_DOWN */
+static void jl2xxx_fld_txn(struct jl_reg_txn *txn, u8 msecs)
+{
+	u16 val;
+
+#if (JL2XXX_PHY_TUNABLE)
+	if (msecs == ETHTOOL_PHY_FAST_LINK_DOWN_OFF) {
+		jlsemi_txn_field(txn, &jl2xxx_fld_en, 0);
+		return;
+	}
+#endif
+	if (msecs <= 5)
+		val = JL2XXX_FLD_DELAY_00MS;
+	else if (msecs <= 15)
+		val = JL2XXX_FLD_DELAY_10MS;
+	else if (msecs <= 30)
+		val = JL2XXX_FLD_DELAY_20MS;
+	else
+		val = JL2XXX_FLD_DELAY_40MS;
+
+	jlsemi_txn_field(txn, &jl2xxx_fld_delay, val);
+	jlsemi_txn_field(txn, &jl2xxx_fld_en, 1);
+}
+
+static void jl2xxx_fld_static_op_build(struct phy_device *phydev,
+				       struct jl_reg_txn *txn)
+{
+	struct jl2xxx_priv *priv = phydev->priv;
+
+	jl2xxx_fld_txn(txn, priv->fld.delay & 0xff);
+}
+
 static int jl1xxx_wol_cfg_rmii(struct phy_device *phydev)
 {
 	int err;
@@ -1039,18 +1226,22 @@ static int jl1xxx_wol_store_mac_addr(struct phy_device *phydev)
 
 static int jl2xxx_wol_enable(struct phy_device *phydev, bool enable)
 {
+	struct jl_reg_txn txn;
+
+	jlsemi_txn_init(&txn);
 	if (enable) {
-		jlsemi_set_bits(phydev, JL2XXX_WOL_CTRL_PAGE,
-				JL2XXX_WOL_CTRL_REG, JL2XXX_WOL_GLB_EN);
-		jlsemi_clear_bits(phydev, JL2XXX_WOL_STAS_PAGE,
-				  JL2XXX_WOL_STAS_REG, JL2XXX_WOL_EN);
+		jlsemi_txn_set_bits(&txn, JL2XXX_WOL_CTRL_PAGE,
+				    JL2XXX_WOL_CTRL_REG, JL2XXX_WOL_GLB_EN);
+		jlsemi_txn_clear_bits(&txn, JL2XXX_WOL_STAS_PAGE,
+				      JL2XXX_WOL_STAS_REG, JL2XXX_WOL_EN);
 	} else {
-		jlsemi_clear_bits(phydev, JL2XXX_WOL_CTRL_PAGE,
-				  JL2XXX_WOL_CTRL_REG, JL2XXX_WOL_GLB_EN);
-		jlsemi_set_bits(phydev, JL2XXX_WOL_STAS_PAGE,
-				JL2XXX_WOL_STAS_REG, JL2XXX_WOL_EN);
+		jlsemi_txn_clear_bits(&txn, JL2XXX_WOL_CTRL_PAGE,
+				      JL2XXX_WOL_CTRL_REG, JL2XXX_WOL_GLB_EN);
+		jlsemi_txn_set_bits(&txn, JL2XXX_WOL_STAS_PAGE,
+				    JL2XXX_WOL_STAS_REG, JL2XXX_WOL_EN);
 	}
-	jlsemi_soft_reset(phydev);
+	jlsemi_txn_commit(phydev, &txn);
+	jlsemi_request_reset(phydev);
 
 	return 0;
 }
@@ -1149,39 +1340,12 @@ int jl2xxx_fld_dynamic_op_get(struct phy_device *phydev, u8 *msecs)
 /* Set fast link down for jl2xxx */
 int jl2xxx_fld_dynamic_op_set(struct phy_device *phydev, const u8 *msecs)
 {
-	u16 val;
-	int ret;
-
-#if (JL2XXX_PHY_TUNABLE)
-	if (*msecs == ETHTOOL_PHY_FAST_LINK_DOWN_OFF)
-		return jlsemi_clear_bits(phydev, JL2XXX_PAGE128,
-					 JL2XXX_FLD_CTRL_REG,
-					 JL2XXX_FLD_EN);
-#endif
-	if (*msecs <= 5)
-		val = JL2XXX_FLD_DELAY_00MS;
-	else if (*msecs <= 15)
-		val = JL2XXX_FLD_DELAY_10MS;
-	else if (*msecs <= 30)
-		val = JL2XXX_FLD_DELAY_20MS;
-	else
-		val = JL2XXX_FLD_DELAY_40MS;
-
-	val = val << JL2XXX_FLD_MASK_HEAD;
+	struct jl_reg_txn txn;
 
-	ret = jlsemi_modify_paged_reg(phydev, JL2XXX_PAGE128,
-				      JL2XXX_FLD_CTRL_REG,
-				      JL2XXX_FLD_MASK, val);
-	if (ret < 0)
-		return ret;
-
-	ret = jlsemi_set_bits(phydev, JL2XXX_PAGE128,
-			      JL2XXX_FLD_CTRL_REG,
-			      JL2XXX_FLD_EN);
-	if (ret < 0)
-		return ret;
+	jlsemi_txn_init(&txn);
+	jl2xxx_fld_txn(&txn, *msecs);
 
-	return 0;
+	return jlsemi_txn_commit(phydev, &txn);
 }
 
 int jl2xxx_downshift_dynamic_op_get(struct phy_device *phydev, u8 *data)
@@ -1205,136 +1369,104 @@ int jl2xxx_downshift_dynamic_op_get(struct phy_device *phydev, u8 *data)
 	return 0;
 }
 
-int jl2xxx_downshift_dynamic_op_set(struct phy_device *phydev, u8 cnt)
+/* Queue a downshift setting, @cnt 0 disables it */
+static void jl2xxx_downshift_txn(struct jl_reg_txn *txn, u8 cnt)
 {
-	int val, err;
+	u16 val;
 
-	if (cnt > JL2XXX_DSFT_CNT_MAX)
-		return -E2BIG;
+	if (cnt > JL2XXX_DSFT_CNT_MAX) {
+		txn->err = -E2BIG;
+		return;
+	}
 
 	if (!cnt) {
-		err = jlsemi_clear_bits(phydev, JL2XXX_PAGE0,
-					JL2XXX_DSFT_CTRL_REG,
-					JL2XXX_DSFT_EN);
+		jlsemi_txn_clear_bits(txn, JL2XXX_PAGE0,
+				      JL2XXX_DSFT_CTRL_REG,
+				      JL2XXX_DSFT_EN);
 	} else {
 		val = ((cnt - 1) & JL2XXX_DSFT_AN_MASK) | JL2XXX_DSFT_EN |
 			JL2XXX_DSFT_SMART_EN | JL2XXX_DSFT_AN_ERR_EN |
 			JL2XXX_DSFT_STL_CNT(18);
-		err = jlsemi_modify_paged_reg(phydev, JL2XXX_PAGE0,
-					      JL2XXX_DSFT_CTRL_REG,
-					      JL2XXX_DSFT_AN_MASK, val);
+		jlsemi_txn_modify(txn, JL2XXX_PAGE0,
+				  JL2XXX_DSFT_CTRL_REG,
+				  JL2XXX_DSFT_AN_MASK, val);
 	}
+}
 
-	if (err < 0)
-		return err;
+int jl2xxx_downshift_dynamic_op_set(struct phy_device *phydev, u8 cnt)
+{
+	struct jl_reg_txn txn;
 
-	return 0;
+	jlsemi_txn_init(&txn);
+	jl2xxx_downshift_txn(&txn, cnt);
+
+	return jlsemi_txn_commit(phydev, &txn);
 }
 
-int jl2xxx_downshift_static_op_set(struct phy_device *phydev)
+static void jl2xxx_downshift_static_op_build(struct phy_device *phydev,
+					     struct jl_reg_txn *txn)
 {
 	struct jl2xxx_priv *priv = phydev->priv;
-	int err;
-
-	err = jl2xxx_downshift_dynamic_op_set(phydev,
-					      priv->downshift.count);
-	if (err < 0)
-		return err;
 
-	return 0;
+	jl2xxx_downshift_txn(txn, priv->downshift.count);
 }
 
-int jl2xxx_rgmii_static_op_set(struct phy_device *phydev)
+static void jl2xxx_rgmii_static_op_build(struct phy_device *phydev,
+					 struct jl_reg_txn *txn)
 {
 	struct jl2xxx_priv *priv = phydev->priv;
-	int err;
 
-	if (priv->rgmii.enable & JL2XXX_RGMII_TX_DLY_EN) {
-		err = jlsemi_set_bits(phydev, JL2XXX_PAGE3336,
+	if (priv->rgmii.enable & JL2XXX_RGMII_TX_DLY_EN)
+		jlsemi_txn_set_bits(txn, JL2XXX_PAGE3336,
+				    JL2XXX_RGMII_CTRL_REG,
+				    priv->rgmii.tx_delay);
+	else
+		jlsemi_txn_clear_bits(txn, JL2XXX_PAGE3336,
 				      JL2XXX_RGMII_CTRL_REG,
 				      priv->rgmii.tx_delay);
-		if (err < 0)
-			return err;
-
-	} else {
-		err = jlsemi_clear_bits(phydev, JL2XXX_PAGE3336,
-					JL2XXX_RGMII_CTRL_REG,
-					priv->rgmii.tx_delay);
-		if (err < 0)
-			return err;
-	}
 
-	if (priv->rgmii.enable & JL2XXX_RGMII_RX_DLY_EN) {
-		err = jlsemi_set_bits(phydev, JL2XXX_PAGE3336,
-				      JL2XXX_RGMII_CTRL_REG,
-				      priv->rgmii.rx_delay);
-		if (err < 0)
-			return err;
-	} else {
-		err = jlsemi_clear_bits(phydev, JL2XXX_PAGE3336,
+	if (priv->rgmii.enable & JL2XXX_RGMII_RX_DLY_EN)
+		jlsemi_txn_set_bits(txn, JL2XXX_PAGE3336,
+				    JL2XXX_RGMII_CTRL_REG,
+				    priv->rgmii.rx_delay);
+	else
+		jlsemi_txn_clear_bits(txn, JL2XXX_PAGE3336,
 				      JL2XXX_RGMII_CTRL_REG,
 				      priv->rgmii.rx_delay);
-		if (err < 0)
-			return err;
-	}
-
-	err = jlsemi_soft_reset(phydev);
-	if (err < 0)
-		return err;
-
-	return 0;
 }
 
-int jl2xxx_clk_static_op_set(struct phy_device *phydev)
+static void jl2xxx_clk_static_op_build(struct phy_device *phydev,
+				       struct jl_reg_txn *txn)
 {
 	struct jl2xxx_priv *priv = phydev->priv;
-	int err;
-
-	if (priv->clk.enable & JL2XXX_125M_CLK_OUT_EN) {
-		err = jlsemi_modify_paged_reg(phydev, JL2XXX_PAGE2627,
-					      JL2XXX_CLK_CTRL_REG,
-					      JL2XXX_CLK_SSC_EN,
-					      JL2XXX_CLK_OUT_PIN |
-					      JL2XXX_CLK_125M_OUT |
-					      JL2XXXX_CLK_SRC);
-		if (err < 0)
-			return err;
-	} else if (priv->clk.enable & JL2XXX_25M_CLK_OUT_EN) {
-		err = jlsemi_modify_paged_reg(phydev, JL2XXX_PAGE2627,
-					      JL2XXX_CLK_CTRL_REG,
-					      JL2XXX_CLK_SSC_EN |
-					      JL2XXX_CLK_125M_OUT,
-					      JL2XXX_CLK_OUT_PIN |
-					      JL2XXXX_CLK_SRC);
-		if (err < 0)
-			return err;
-	} else if (priv->clk.enable & JL2XXX_CLK_OUT_DIS) {
-		err = jlsemi_clear_bits(phydev, JL2XXX_PAGE2627,
-					JL2XXX_CLK_CTRL_REG,
-					JL2XXX_CLK_OUT_PIN);
-		if (err < 0)
-			return err;
-	}
-
-	err = jlsemi_soft_reset(phydev);
-	if (err < 0)
-		return err;
 
-	return 0;
+	if (priv->clk.enable & JL2XXX_125M_CLK_OUT_EN)
+		jlsemi_txn_modify(txn, JL2XXX_PAGE2627,
+				  JL2XXX_CLK_CTRL_REG,
+				  JL2XXX_CLK_SSC_EN,
+				  JL2XXX_CLK_OUT_PIN |
+				  JL2XXX_CLK_125M_OUT |
+				  JL2XXXX_CLK_SRC);
+	else if (priv->clk.enable & JL2XXX_25M_CLK_OUT_EN)
+		jlsemi_txn_modify(txn, JL2XXX_PAGE2627,
+				  JL2XXX_CLK_CTRL_REG,
+				  JL2XXX_CLK_SSC_EN |
+				  JL2XXX_CLK_125M_OUT,
+				  JL2XXX_CLK_OUT_PIN |
+				  JL2XXXX_CLK_SRC);
+	else if (priv->clk.enable & JL2XXX_CLK_OUT_DIS)
+		jlsemi_txn_clear_bits(txn, JL2XXX_PAGE2627,
+				      JL2XXX_CLK_CTRL_REG,
+				      JL2XXX_CLK_OUT_PIN);
 }
 
-int jl2xxx_slew_rate_static_op_set(struct phy_device *phydev)
+static void jl2xxx_slew_rate_static_op_build(struct phy_device *phydev,
+					     struct jl_reg_txn *txn)
 {
-	int err;
-
-	err = jlsemi_set_bits(phydev, JL2XXX_PAGE258,
-			      JL2XXX_SLEW_RATE_CTRL_REG,
-			      JL2XXX_SLEW_RATE_EN | JL2XXX_SLEW_RATE_REF_CLK |
-			      JL2XXX_SLEW_RATE_SEL_CLK);
-	if (err < 0)
-		return err;
-
-	return 0;
+	jlsemi_txn_set_bits(txn, JL2XXX_PAGE258,
+			    JL2XXX_SLEW_RATE_CTRL_REG,
+			    JL2XXX_SLEW_RATE_EN | JL2XXX_SLEW_RATE_REF_CLK |
+			    JL2XXX_SLEW_RATE_SEL_CLK);
 }
 
 int jl2xxx_rxc_out_static_op_set(struct phy_device *phydev)
@@ -1349,7 +1481,9 @@ int jl2xxx_rxc_out_static_op_set(struct phy_device *phydev)
 	if (err < 0)
 		return err;
 
-	mode = jlsemi_read_paged(phydev, JL2XXX_PAGE18, JL2XXX_WORK_MODE_REG);
+	mode = jl2xxx_work_mode_get(phydev);
+	if (mode < 0)
+		return mode;
 	/* Description: Some SOC Ethernet initialization requires PHY to
 	 * provide rx clock for MAC to pass initialization, otherwise DMA
 	 * initialization errors will be reported. However, when PHY is
@@ -1362,40 +1496,74 @@ int jl2xxx_rxc_out_static_op_set(struct phy_device *phydev)
 	 */
 	if (((priv->work_mode.enable & JL2XXX_WORK_MODE_STATIC_OP_EN) &&
 	   (priv->work_mode.mode == JL2XXX_MAC_SGMII_RGMII_MODE)) ||
-	   ((mode & JL2XXX_WORK_MODE_MASK) == JL2XXX_MAC_SGMII_RGMII_MODE)) {
+	   (mode == JL2XXX_MAC_SGMII_RGMII_MODE)) {
 		err = jlsemi_modify_paged_reg(phydev, JL2XXX_PAGE18,
 					      JL2XXX_WORK_MODE_REG,
 					      JL2XXX_WORK_MODE_MASK,
 					      JL2XXX_UTP_RGMII_MODE);
 		if (err < 0)
 			return err;
+		priv->work_mode.cur = JL2XXX_UTP_RGMII_MODE;
 		/* Record the previous value */
 		priv->work_mode.mode = JL2XXX_MAC_SGMII_RGMII_MODE;
 		priv->rxc_out.inited = false;
 	}
 
-	err = jlsemi_soft_reset(phydev);
+	err = jlsemi_request_reset(phydev);
 	if (err < 0)
 		return err;
 
 	return 0;
 }
 
-int jl2xxx_work_mode_static_op_set(struct phy_device *phydev)
+/**
+ * jl2xxx_work_mode_get() - the work mode the phy runs in
+ * @phydev: a pointer to a &struct phy_device
+ *
+ * Only the driver changes the work mode, so the register is read once
+ * and then again only after jl2xxx_work_mode_forget(), e.g. on reset.
+ *
+ * Return: the work mode or negative errno
+ */
+int jl2xxx_work_mode_get(struct phy_device *phydev)
 {
 	struct jl2xxx_priv *priv = phydev->priv;
-	int err;
+	int val;
 
-	jlsemi_modify_paged_reg(phydev, JL2XXX_PAGE18,
-				JL2XXX_WORK_MODE_REG,
-				JL2XXX_WORK_MODE_MASK,
-				priv->work_mode.mode);
+	if (priv->work_mode.cur != JL2XXX_WORK_MODE_UNKNOWN)
+		return priv->work_mode.cur;
 
-	err = jlsemi_soft_reset(phydev);
-	if (err < 0)
-		return err;
+	val = jlsemi_read_paged(phydev, JL2XXX_PAGE18, JL2XXX_WORK_MODE_REG);
+	if (val < 0)
+		return val;
 
-	return 0;
+	priv->work_mode.cur = val & JL2XXX_WORK_MODE_MASK;
+
+	return priv->work_mode.cur;
+}
+
+/**
+ * jl2xxx_work_mode_forget() - read the work mode again on next use
+ * @phydev: a pointer to a &struct phy_device
+ */
+void jl2xxx_work_mode_forget(struct phy_device *phydev)
+{
+	struct jl2xxx_priv *priv = phydev->priv;
+
+	if (priv && (phydev->phy_id & JLSEMI_PHY_ID_MASK) ==
+	    (JL2XXX_PHY_ID & JLSEMI_PHY_ID_MASK))
+		priv->work_mode.cur = JL2XXX_WORK_MODE_UNKNOWN;
+}
+
+static void jl2xxx_work_mode_static_op_build(struct phy_device *phydev,
+					     struct jl_reg_txn *txn)
+{
+	struct jl2xxx_priv *priv = phydev->priv;
+
+	jlsemi_txn_modify(txn, JL2XXX_PAGE18,
+			  JL2XXX_WORK_MODE_REG,
+			  JL2XXX_WORK_MODE_MASK,
+			  priv->work_mode.mode);
 }
 
 static inline int __genphy_setup_forced(struct phy_device *phydev)
@@ -1493,11 +1661,9 @@ static int jl2xxx_update_fiber_status(struct phy_device *phydev)
 bool jl2xxx_read_fiber_status(struct phy_device *phydev)
 {
 	bool fiber_ok = false;
-	u16 phy_mode;
-	int val;
+	int phy_mode;
 
-	val = jlsemi_read_paged(phydev, JL2XXX_PAGE18, JL2XXX_WORK_MODE_REG);
-	phy_mode = val & JL2XXX_WORK_MODE_MASK;
+	phy_mode = jl2xxx_work_mode_get(phydev);
 
 	if ((phydev->interface != PHY_INTERFACE_MODE_SGMII) &&
 	   ((phy_mode == JL2XXX_FIBER_RGMII_MODE) ||
@@ -1506,60 +1672,69 @@ bool jl2xxx_read_fiber_status(struct phy_device *phydev)
 		if (phydev->link)
 			fiber_ok = true;
 	}
+	trace_jlsemi_media(jlsemi_trace_dev(phydev), phy_mode,
+			   phydev->interface, fiber_ok);
 
 	return fiber_ok;
 }
 
-static int jl2xxx_force_speed(struct phy_device *phydev, u16 speed)
+static void jl2xxx_force_speed(struct jl_reg_txn *txn, u16 speed)
 {
-	int err;
-
 	if (speed == JL2XXX_SPEED1000)
-		jlsemi_modify_paged_reg(phydev, JL2XXX_PAGE0, MII_BMCR,
-					BMCR_SPEED100, BMCR_SPEED1000);
+		jlsemi_txn_modify(txn, JL2XXX_PAGE0, MII_BMCR,
+				  BMCR_SPEED100, BMCR_SPEED1000);
 	else if (speed == JL2XXX_SPEED100)
-		jlsemi_modify_paged_reg(phydev, JL2XXX_PAGE0, MII_BMCR,
-					BMCR_SPEED1000, BMCR_SPEED100);
+		jlsemi_txn_modify(txn, JL2XXX_PAGE0, MII_BMCR,
+				  BMCR_SPEED1000, BMCR_SPEED100);
 	else if (speed == JL2XXX_SPEED10)
-		jlsemi_clear_bits(phydev, JL2XXX_PAGE0, MII_BMCR,
-				  BMCR_SPEED1000 | BMCR_SPEED100);
-
-	err = jlsemi_clear_bits(phydev, JL2XXX_PAGE0, MII_BMCR,
-				BMCR_ANENABLE);
-	if (err < 0)
-		return err;
+		jlsemi_txn_clear_bits(txn, JL2XXX_PAGE0, MII_BMCR,
+				      BMCR_SPEED1000 | BMCR_SPEED100);
 
-	return 0;
+	jlsemi_txn_clear_bits(txn, JL2XXX_PAGE0, MII_BMCR, BMCR_ANENABLE);
 }
 
-static int jl2xxx_lpbk_force_speed(struct phy_device *phydev)
+static void jl2xxx_lpbk_force_speed(struct phy_device *phydev,
+				    struct jl_reg_txn *txn)
 {
 	struct jl2xxx_priv *priv = phydev->priv;
 
 	if (priv->lpbk.mode == JL2XXX_LPBK_PCS_1000M)
-		jl2xxx_force_speed(phydev, JL2XXX_SPEED1000);
+		jl2xxx_force_speed(txn, JL2XXX_SPEED1000);
 	else if (priv->lpbk.mode == JL2XXX_LPBK_PCS_100M)
-		jl2xxx_force_speed(phydev, JL2XXX_SPEED100);
+		jl2xxx_force_speed(txn, JL2XXX_SPEED100);
 	else if (priv->lpbk.mode == JL2XXX_LPBK_PCS_10M)
-		jl2xxx_force_speed(phydev, JL2XXX_SPEED10);
+		jl2xxx_force_speed(txn, JL2XXX_SPEED10);
+}
 
-	return 0;
+static bool jl2xxx_lpbk_is_pcs(struct phy_device *phydev)
+{
+	struct jl2xxx_priv *priv = phydev->priv;
+
+	return (priv->lpbk.mode == JL2XXX_LPBK_PCS_10M) ||
+	       (priv->lpbk.mode == JL2XXX_LPBK_PCS_100M) ||
+	       (priv->lpbk.mode == JL2XXX_LPBK_PCS_1000M);
 }
 
+/* The pcs loopbacks live in BMCR, which a soft reset puts back to its
+ * defaults, so any pending reset is issued first. The pmd and external
+ * loopbacks need the cpu held in reset.
+ */
 int jl2xxx_lpbk_static_op_set(struct phy_device *phydev)
 {
 	struct jl2xxx_priv *priv = phydev->priv;
+	struct jl_reg_txn txn;
 	int err;
 
-	if ((priv->lpbk.mode == JL2XXX_LPBK_PCS_10M) ||
-	    (priv->lpbk.mode == JL2XXX_LPBK_PCS_100M) ||
-	    (priv->lpbk.mode == JL2XXX_LPBK_PCS_1000M)) {
-		err = jlsemi_modify_paged_reg(phydev, JL2XXX_PAGE0,
-					      MII_BMCR, BMCR_LOOPBACK,
-					      BMCR_LOOPBACK);
+	if (jl2xxx_lpbk_is_pcs(phydev)) {
+		err = jlsemi_reset_barrier(phydev);
 		if (err < 0)
 			return err;
-		err = jl2xxx_lpbk_force_speed(phydev);
+
+		jlsemi_txn_init(&txn);
+		jlsemi_txn_set_bits(&txn, JL2XXX_PAGE0, MII_BMCR,
+				    BMCR_LOOPBACK);
+		jl2xxx_lpbk_force_speed(phydev, &txn);
+		err = jlsemi_txn_commit(phydev, &txn);
 		if (err < 0)
 			return err;
 	} else if (priv->lpbk.mode == JL2XXX_LPBK_PMD_1000M) {
@@ -1590,7 +1765,7 @@ int jl2xxx_lpbk_static_op_set(struct phy_device *phydev)
 		if (err < 0)
 			return err;
 
-		err = jlsemi_soft_reset(phydev);
+		err = jlsemi_request_reset(phydev);
 		if (err < 0)
 			return err;
 
@@ -1621,7 +1796,7 @@ int jl2xxx_lpbk_static_op_set(struct phy_device *phydev)
 		if (err < 0)
 			return err;
 
-		err = jlsemi_soft_reset(phydev);
+		err = jlsemi_request_reset(phydev);
 		if (err < 0)
 			return err;
 	}
@@ -1629,583 +1804,531 @@ int jl2xxx_lpbk_static_op_set(struct phy_device *phydev)
 	return 0;
 }
 
-int jl1xxx_mdi_static_op_set(struct phy_device *phydev)
+static void jl1xxx_mdi_static_op_build(struct phy_device *phydev,
+				       struct jl_reg_txn *txn)
 {
 	struct jl1xxx_priv *priv = phydev->priv;
-	int err;
-
-	if (priv->mdi.enable & JL1XXX_MDI_RATE_EN) {
-		err = jlsemi_set_bits(phydev, JL1XXX_PAGE24,
-				      JL1XXX_REG24, priv->mdi.rate);
-		if (err < 0)
-			return err;
-	}
 
-	if (priv->mdi.enable & JL1XXX_MDI_AMPLITUDE_EN) {
-		err = jlsemi_modify_paged_reg(phydev, JL1XXX_PAGE24,
-					      JL1XXX_REG24,
-					      JL1XXX_MDI_TX_BM_MASK,
-					      JL1XXX_MDI_TX_BM(
-					      priv->mdi.amplitude));
-		if (err < 0)
-			return err;
-	}
+	if (priv->mdi.enable & JL1XXX_MDI_RATE_EN)
+		jlsemi_txn_set_bits(txn, JL1XXX_PAGE24,
+				    JL1XXX_REG24, priv->mdi.rate);
 
-	return 0;
+	if (priv->mdi.enable & JL1XXX_MDI_AMPLITUDE_EN)
+		jlsemi_txn_field(txn, &jl1xxx_mdi_amplitude,
+				 priv->mdi.amplitude);
 }
 
-int jl1xxx_rmii_static_op_set(struct phy_device *phydev)
+static void jl1xxx_rmii_static_op_build(struct phy_device *phydev,
+					struct jl_reg_txn *txn)
 {
 	struct jl1xxx_priv *priv = phydev->priv;
-	int err;
+	u32 enable = priv->rmii.enable;
 
-	if (priv->rmii.enable & JL1XXX_RMII_MODE_EN) {
-		err = jlsemi_set_bits(phydev, JL1XXX_PAGE7,
-				      JL1XXX_REG16, JL1XXX_RMII_MODE);
-		if (err < 0)
-			return err;
-	} else {
-		err = jlsemi_clear_bits(phydev, JL1XXX_PAGE7,
-					JL1XXX_REG16, JL1XXX_RMII_MODE);
-		if (err < 0)
-			return err;
-		return 0;
-	}
+	jlsemi_txn_field(txn, &jl1xxx_rmii_mode,
+			 !!(enable & JL1XXX_RMII_MODE_EN));
+	if (!(enable & JL1XXX_RMII_MODE_EN))
+		return;
 
-	if (priv->rmii.enable & JL1XXX_RMII_CLK_50M_INPUT_EN) {
-		err = jlsemi_set_bits(phydev, JL1XXX_PAGE7,
-				      JL1XXX_REG16,
-				      JL1XXX_RMII_CLK_50M_INPUT);
-		if (err < 0)
-			return err;
-	} else {
-		err = jlsemi_clear_bits(phydev, JL1XXX_PAGE7,
-					JL1XXX_REG16,
-					JL1XXX_RMII_CLK_50M_INPUT);
-		if (err < 0)
-			return err;
-	}
+	jlsemi_txn_field(txn, &jl1xxx_rmii_clk_50m_input,
+			 !!(enable & JL1XXX_RMII_CLK_50M_INPUT_EN));
+	jlsemi_txn_field(txn, &jl1xxx_rmii_crs_dv,
+			 !!(enable & JL1XXX_RMII_CRS_DV_EN));
 
-	if (priv->rmii.enable & JL1XXX_RMII_CRS_DV_EN) {
-		err = jlsemi_set_bits(phydev, JL1XXX_PAGE7,
-				      JL1XXX_REG16,
-				      JL1XXX_RMII_CRS_DV);
-		if (err < 0)
-			return err;
-	} else {
-		err = jlsemi_clear_bits(phydev, JL1XXX_PAGE7,
-					JL1XXX_REG16,
-					JL1XXX_RMII_CRS_DV);
-		if (err < 0)
-			return err;
-	}
+	if (enable & JL1XXX_RMII_TX_SKEW_EN)
+		jlsemi_txn_field(txn, &jl1xxx_rmii_tx_skew,
+				 priv->rmii.tx_timing);
 
-	if (priv->rmii.enable & JL1XXX_RMII_TX_SKEW_EN) {
-		err = jlsemi_modify_paged_reg(phydev, JL1XXX_PAGE7,
-					      JL1XXX_REG16,
-					      JL1XXX_RMII_TX_SKEW_MASK,
-					      JL1XXX_RMII_TX_SKEW(
-					      priv->rmii.tx_timing));
-		if (err < 0)
-			return err;
-	}
-
-	if (priv->rmii.enable & JL1XXX_RMII_RX_SKEW_EN) {
-		err = jlsemi_modify_paged_reg(phydev, JL1XXX_PAGE7,
-					      JL1XXX_REG16,
-					      JL1XXX_RMII_RX_SKEW_MASK,
-					      JL1XXX_RMII_RX_SKEW(
-					      priv->rmii.rx_timing));
-		if (err < 0)
-			return err;
-	}
-
-	return 0;
+	if (enable & JL1XXX_RMII_RX_SKEW_EN)
+		jlsemi_txn_field(txn, &jl1xxx_rmii_rx_skew,
+				 priv->rmii.rx_timing);
 }
 
+#if (JL2XXX_PATCH_BUILTIN)
 static const u16 patch_fw_versions0[] = {0x9101, 0x9107};
 static const u16 patch_fw_versions1[] = {0x1101};
 static const u16 patch_fw_versions2[] = {0x930a};
 static const u16 patch_fw_versions3[] = {0x2208};
 
 static const u16 patch_version0 = 0xdef2;
-static const u32 init_data0[] = {
-	0x1f00a0, 0x1903f3, 0x1f0012, 0x150100, 0x1f00ad, 0x100000,
-	0x11e0c6, 0x1f00a0, 0x1903fb, 0x1903fb, 0x1903fb, 0x1903fb,
-	0x1903fb, 0x1903fb, 0x1903fb, 0x1903fb, 0x1f00ad, 0x110000,
-	0x120400, 0x130093, 0x140000, 0x150193, 0x160000, 0x170213,
-	0x180000, 0x12040c, 0x130293, 0x140000, 0x150313, 0x160000,
-	0x170393, 0x180000, 0x120418, 0x130413, 0x140000, 0x150493,
-	0x160000, 0x170513, 0x180000, 0x120424, 0x130593, 0x140000,
-	0x150613, 0x160000, 0x170693, 0x180000, 0x120430, 0x130713,
-	0x140000, 0x150793, 0x160000, 0x171137, 0x180000, 0x12043c,
-	0x13006f, 0x140060, 0x15a001, 0x160113, 0x17fd41, 0x18d026,
-	0x120448, 0x13d406, 0x14d222, 0x1517b7, 0x160800, 0x17aa23,
-	0x189407, 0x120454, 0x130713, 0x1430f0, 0x1567b7, 0x160800,
-	0x17a423, 0x1846e7, 0x120460, 0x13a703, 0x14a587, 0x156685,
-	0x168f55, 0x17ac23, 0x18a4e7, 0x12046c, 0x1367b9, 0x145737,
-	0x150800, 0x168793, 0x17ef27, 0x182023, 0x120478, 0x1374f7,
-	0x1407b7, 0x150800, 0x165bfc, 0x17d493, 0x180037, 0x120484,
-	0x13f493, 0x141f04, 0x15f793, 0x1607f7, 0x178fc5, 0x18c03e,
-	0x120490, 0x134702, 0x140793, 0x150210, 0x160763, 0x1700f7,
-	0x180793, 0x12049c, 0x130270, 0x140c63, 0x1530f7, 0x16a001,
-	0x1707b7, 0x180002, 0x1204a8, 0x138793, 0x146967, 0x15c83e,
-	0x1617b7, 0x170002, 0x188793, 0x1204b4, 0x13e567, 0x14c43e,
-	0x1537b7, 0x160002, 0x178793, 0x186867, 0x1204c0, 0x13c23e,
-	0x1447b7, 0x150002, 0x168793, 0x17e9a7, 0x1866b7, 0x1204cc,
-	0x130800, 0x14ca3e, 0x15a783, 0x166d86, 0x1775c1, 0x188713,
-	0x1204d8, 0x130ff5, 0x148ff9, 0x156735, 0x160713, 0x178007,
-	0x188fd9, 0x1204e4, 0x13ac23, 0x146cf6, 0x15a783, 0x1665c6,
-	0x175737, 0x180800, 0x1204f0, 0x136611, 0x14f793, 0x15f0f7,
-	0x16e793, 0x170807, 0x18ae23, 0x1204fc, 0x1364f6, 0x142783,
-	0x155c47, 0x169bf5, 0x172223, 0x185cf7, 0x120508, 0x13a703,
-	0x14f5c6, 0x158f51, 0x16ae23, 0x17f4e6, 0x180737, 0x120514,
-	0x130809, 0x14433c, 0x158fd1, 0x16c33c, 0x170637, 0x180800,
-	0x120520, 0x134a74, 0x14679d, 0x158793, 0x160e07, 0x179ae1,
-	0x18e693, 0x12052c, 0x130036, 0x14ca74, 0x154678, 0x1676e1,
-	0x178693, 0x185006, 0x120538, 0x138ff9, 0x148fd5, 0x1507c2,
-	0x168f6d, 0x1783c1, 0x188fd9, 0x120544, 0x13c67c, 0x140713,
-	0x151000, 0x160793, 0x170000, 0x189c23, 0x120550, 0x1324e7,
-	0x140713, 0x151010, 0x169123, 0x1726e7, 0x18470d, 0x12055c,
-	0x13c63a, 0x144702, 0x158d23, 0x162407, 0x17a223, 0x182607,
-	0x120568, 0x130793, 0x140270, 0x150413, 0x160000, 0x171463,
-	0x1800f7, 0x120574, 0x134789, 0x14c63e, 0x154709, 0x16cc3a,
-	0x174702, 0x180793, 0x120580, 0x130270, 0x141463, 0x1500f7,
-	0x16478d, 0x17cc3e, 0x180513, 0x12058c, 0x130000, 0x144792,
-	0x154581, 0x164485, 0x179782, 0x184018, 0x120598, 0x131775,
-	0x14e563, 0x1502e4, 0x162703, 0x170a04, 0x181163, 0x1205a4,
-	0x130297, 0x144818, 0x150563, 0x160097, 0x1747a2, 0x18c804,
-	0x1205b0, 0x139782, 0x1466b7, 0x150800, 0x16a703, 0x174c46,
-	0x189b71, 0x1205bc, 0x136713, 0x140027, 0x15a223, 0x164ce6,
-	0x174783, 0x180fd4, 0x1205c8, 0x13c7b9, 0x142683, 0x151004,
-	0x164745, 0x179763, 0x1820e6, 0x1205d4, 0x133737, 0x140822,
-	0x152683, 0x163007, 0x177645, 0x18167d, 0x1205e0, 0x138ef1,
-	0x142023, 0x1530d7, 0x162683, 0x172807, 0x18e693, 0x1205ec,
-	0x131006, 0x142023, 0x1528d7, 0x162683, 0x173807, 0x18e693,
-	0x1205f8, 0x131006, 0x142023, 0x1538d7, 0x162683, 0x174007,
-	0x18e693, 0x120604, 0x131006, 0x142023, 0x1540d7, 0x162683,
-	0x174807, 0x18e693, 0x120610, 0x131006, 0x142023, 0x1548d7,
-	0x1656b7, 0x170800, 0x18a703, 0x12061c, 0x133486, 0x14830d,
-	0x158b05, 0x16cf01, 0x17a703, 0x185c46, 0x120628, 0x137671,
-	0x14167d, 0x158f71, 0x166611, 0x17a223, 0x185ce6, 0x120634,
-	0x138f51, 0x14a223, 0x155ce6, 0x162703, 0x171084, 0x1846b2,
-	0x120640, 0x131c63, 0x1402d7, 0x153737, 0x160822, 0x172683,
-	0x182807, 0x12064c, 0x13e693, 0x140016, 0x152023, 0x1628d7,
-	0x172683, 0x183807, 0x120658, 0x13e693, 0x140016, 0x152023,
-	0x1638d7, 0x172683, 0x184007, 0x120664, 0x13e693, 0x140016,
-	0x152023, 0x1640d7, 0x172683, 0x184807, 0x120670, 0x13e693,
-	0x140016, 0x152023, 0x1648d7, 0x172703, 0x181004, 0x12067c,
-	0x1346b2, 0x149c63, 0x151ae6, 0x160737, 0x170800, 0x184b78,
-	0x120688, 0x130693, 0x140ff0, 0x15463d, 0x168b1d, 0x17ce3a,
-	0x1852b7, 0x120694, 0x130800, 0x144701, 0x154389, 0x16408d,
-	0x174311, 0x180537, 0x1206a0, 0x130820, 0x141593, 0x150077,
-	0x1695aa, 0x17418c, 0x184572, 0x1206ac, 0x1305c2, 0x1481c1,
-	0x1581a9, 0x167763, 0x1700b5, 0x189533, 0x1206b8, 0x1300e4,
-	0x144513, 0x15fff5, 0x168e69, 0x170537, 0x180800, 0x1206c4,
-	0x134568, 0x148121, 0x15893d, 0x167463, 0x1702b5, 0x18a583,
-	0x1206d0, 0x1306c2, 0x140763, 0x151277, 0x160a63, 0x171217,
-	0x1805c2, 0x1206dc, 0x1381c1, 0x14818d, 0x150d63, 0x161097,
-	0x178985, 0x180586, 0x1206e8, 0x1395b3, 0x1400b4, 0x15c593,
-	0x16fff5, 0x178eed, 0x180705, 0x1206f4, 0x1315e3, 0x14fa67,
-	0x1535b7, 0x160822, 0x17a703, 0x183005, 0x120700, 0x13757d,
-	0x148a3d, 0x150513, 0x160ff5, 0x178f69, 0x180622, 0x12070c,
-	0x138e59, 0x14a023, 0x1530c5, 0x168637, 0x170800, 0x185a38,
-	0x120718, 0x1375c1, 0x14f693, 0x150ff6, 0x168593, 0x170ff5,
-	0x188f6d, 0x120724, 0x1306a2, 0x148ed9, 0x15da34, 0x164682,
-	0x170713, 0x180210, 0x120730, 0x139163, 0x140ee6, 0x154711,
-	0x16e391, 0x17471d, 0x182023, 0x12073c, 0x1310e4, 0x142683,
-	0x150a04, 0x16471d, 0x179e63, 0x1800e6, 0x120748, 0x136737,
-	0x140800, 0x152703, 0x164cc7, 0x170693, 0x184000, 0x120754,
-	0x137713, 0x144807, 0x151463, 0x1600d7, 0x172223, 0x180e04,
-	0x120760, 0x134018, 0x141163, 0x150497, 0x165703, 0x1700c4,
-	0x181793, 0x12076c, 0x130117, 0x14db63, 0x150207, 0x168737,
-	0x170800, 0x184778, 0x120778, 0x137713, 0x140807, 0x15e705,
-	0x160513, 0x170000, 0x184792, 0x120784, 0x134581, 0x149782,
-	0x1547a2, 0x164711, 0x17c818, 0x18c004, 0x120790, 0x130d23,
-	0x140094, 0x150ca3, 0x160004, 0x179782, 0x1856b7, 0x12079c,
-	0x130800, 0x1442b8, 0x159b71, 0x16c2b8, 0x170513, 0x180000,
-	0x1207a8, 0x1347d2, 0x149782, 0x154703, 0x162684, 0x1703e3,
-	0x18de07, 0x1207b4, 0x13bbd9, 0x1407b7, 0x150002, 0x168793,
-	0x1765c7, 0x18c83e, 0x1207c0, 0x1327b7, 0x140002, 0x158793,
-	0x16dae7, 0x17c43e, 0x1847b7, 0x1207cc, 0x130002, 0x148793,
-	0x151427, 0x16c23e, 0x1757b7, 0x180002, 0x1207d8, 0x138793,
-	0x149867, 0x15b1fd, 0x162683, 0x171504, 0x184709, 0x1207e4,
-	0x1399e3, 0x14e2e6, 0x1536b7, 0x160822, 0x17a703, 0x183006,
-	0x1207f0, 0x13663d, 0x148f51, 0x15a023, 0x1630e6, 0x17bd39,
-	0x18c593, 0x1207fc, 0x130015, 0x14b5dd, 0x158991, 0x1635b3,
-	0x1700b0, 0x180589, 0x120808, 0x13bdf9, 0x148991, 0x15b593,
-	0x160015, 0x17bfdd, 0x180737, 0x120814, 0x130800, 0x144f28,
-	0x15cf89, 0x1647c2, 0x17893d, 0x189782, 0x120820, 0x1347e2,
-	0x140713, 0x151000, 0x162223, 0x1710e4, 0x182423, 0x12082c,
-	0x1310f4, 0x14474d, 0x15b729, 0x168111, 0x17b7dd, 0x1814e3,
-	0x120838, 0x13f097, 0x140737, 0x150800, 0x164770, 0x171713,
-	0x180106, 0x120844, 0x135d63, 0x140607, 0x1585b7, 0x160800,
-	0x17a683, 0x180d05, 0x120850, 0x1372c5, 0x147313, 0x1500f6,
-	0x1612fd, 0x17a703, 0x180d45, 0x12085c, 0x131513, 0x1400c3,
-	0x15f6b3, 0x160056, 0x178ec9, 0x18757d, 0x120868, 0x130393,
-	0x140ff5, 0x151293, 0x160083, 0x17f6b3, 0x180076, 0x120874,
-	0x139b41, 0x148211, 0x15e2b3, 0x160056, 0x171093, 0x180043,
-	0x120880, 0x137693, 0x140016, 0x156333, 0x160067, 0x170613,
-	0x187ff5, 0x12088c, 0x139713, 0x1400b6, 0x157633, 0x1600c3,
-	0x178e59, 0x189513, 0x120898, 0x1300a6, 0x147613, 0x159ff6,
-	0x169713, 0x170096, 0x188e49, 0x1208a4, 0x13f293, 0x14f0f2,
-	0x158e59, 0x16e2b3, 0x170012, 0x1806a2, 0x1208b0, 0x137613,
-	0x14eff6, 0x158e55, 0x16a823, 0x170c55, 0x18aa23, 0x1208bc,
-	0x130cc5, 0x1480e3, 0x15e807, 0x1646b7, 0x170822, 0x18a703,
-	0x1208c8, 0x13f006, 0x149b61, 0x156713, 0x160027, 0x17a023,
-	0x18f0e6, 0x1208d4, 0x13b5ad, 0x140000, 0x150000, 0x160000,
-	0x170000, 0x180000, 0x110000, 0x120400, 0x104000, 0x1f0000,
+static const u16 init_data0[] = {
+	0x1f01, 0x00a0, 0x1901, 0x03f3, 0x1f01, 0x0012, 0x1501, 0x0100,
+	0x1f01, 0x00ad, 0x1002, 0x0000, 0xe0c6, 0x1f01, 0x00a0, 0x1901,
+	0x03fb, 0x1901, 0x03fb, 0x1901, 0x03fb, 0x1901, 0x03fb, 0x1901,
+	0x03fb, 0x1901, 0x03fb, 0x1901, 0x03fb, 0x1901, 0x03fb, 0x1f01,
+	0x00ad, 0x1108, 0x0000, 0x0400, 0x0093, 0x0000, 0x0193, 0x0000,
+	0x0213, 0x0000, 0x1207, 0x040c, 0x0293, 0x0000, 0x0313, 0x0000,
+	0x0393, 0x0000, 0x1207, 0x0418, 0x0413, 0x0000, 0x0493, 0x0000,
+	0x0513, 0x0000, 0x1207, 0x0424, 0x0593, 0x0000, 0x0613, 0x0000,
+	0x0693, 0x0000, 0x1207, 0x0430, 0x0713, 0x0000, 0x0793, 0x0000,
+	0x1137, 0x0000, 0x1207, 0x043c, 0x006f, 0x0060, 0xa001, 0x0113,
+	0xfd41, 0xd026, 0x1207, 0x0448, 0xd406, 0xd222, 0x17b7, 0x0800,
+	0xaa23, 0x9407, 0x1207, 0x0454, 0x0713, 0x30f0, 0x67b7, 0x0800,
+	0xa423, 0x46e7, 0x1207, 0x0460, 0xa703, 0xa587, 0x6685, 0x8f55,
+	0xac23, 0xa4e7, 0x1207, 0x046c, 0x67b9, 0x5737, 0x0800, 0x8793,
+	0xef27, 0x2023, 0x1207, 0x0478, 0x74f7, 0x07b7, 0x0800, 0x5bfc,
+	0xd493, 0x0037, 0x1207, 0x0484, 0xf493, 0x1f04, 0xf793, 0x07f7,
+	0x8fc5, 0xc03e, 0x1207, 0x0490, 0x4702, 0x0793, 0x0210, 0x0763,
+	0x00f7, 0x0793, 0x1207, 0x049c, 0x0270, 0x0c63, 0x30f7, 0xa001,
+	0x07b7, 0x0002, 0x1207, 0x04a8, 0x8793, 0x6967, 0xc83e, 0x17b7,
+	0x0002, 0x8793, 0x1207, 0x04b4, 0xe567, 0xc43e, 0x37b7, 0x0002,
+	0x8793, 0x6867, 0x1207, 0x04c0, 0xc23e, 0x47b7, 0x0002, 0x8793,
+	0xe9a7, 0x66b7, 0x1207, 0x04cc, 0x0800, 0xca3e, 0xa783, 0x6d86,
+	0x75c1, 0x8713, 0x1207, 0x04d8, 0x0ff5, 0x8ff9, 0x6735, 0x0713,
+	0x8007, 0x8fd9, 0x1207, 0x04e4, 0xac23, 0x6cf6, 0xa783, 0x65c6,
+	0x5737, 0x0800, 0x1207, 0x04f0, 0x6611, 0xf793, 0xf0f7, 0xe793,
+	0x0807, 0xae23, 0x1207, 0x04fc, 0x64f6, 0x2783, 0x5c47, 0x9bf5,
+	0x2223, 0x5cf7, 0x1207, 0x0508, 0xa703, 0xf5c6, 0x8f51, 0xae23,
+	0xf4e6, 0x0737, 0x1207, 0x0514, 0x0809, 0x433c, 0x8fd1, 0xc33c,
+	0x0637, 0x0800, 0x1207, 0x0520, 0x4a74, 0x679d, 0x8793, 0x0e07,
+	0x9ae1, 0xe693, 0x1207, 0x052c, 0x0036, 0xca74, 0x4678, 0x76e1,
+	0x8693, 0x5006, 0x1207, 0x0538, 0x8ff9, 0x8fd5, 0x07c2, 0x8f6d,
+	0x83c1, 0x8fd9, 0x1207, 0x0544, 0xc67c, 0x0713, 0x1000, 0x0793,
+	0x0000, 0x9c23, 0x1207, 0x0550, 0x24e7, 0x0713, 0x1010, 0x9123,
+	0x26e7, 0x470d, 0x1207, 0x055c, 0xc63a, 0x4702, 0x8d23, 0x2407,
+	0xa223, 0x2607, 0x1207, 0x0568, 0x0793, 0x0270, 0x0413, 0x0000,
+	0x1463, 0x00f7, 0x1207, 0x0574, 0x4789, 0xc63e, 0x4709, 0xcc3a,
+	0x4702, 0x0793, 0x1207, 0x0580, 0x0270, 0x1463, 0x00f7, 0x478d,
+	0xcc3e, 0x0513, 0x1207, 0x058c, 0x0000, 0x4792, 0x4581, 0x4485,
+	0x9782, 0x4018, 0x1207, 0x0598, 0x1775, 0xe563, 0x02e4, 0x2703,
+	0x0a04, 0x1163, 0x1207, 0x05a4, 0x0297, 0x4818, 0x0563, 0x0097,
+	0x47a2, 0xc804, 0x1207, 0x05b0, 0x9782, 0x66b7, 0x0800, 0xa703,
+	0x4c46, 0x9b71, 0x1207, 0x05bc, 0x6713, 0x0027, 0xa223, 0x4ce6,
+	0x4783, 0x0fd4, 0x1207, 0x05c8, 0xc7b9, 0x2683, 0x1004, 0x4745,
+	0x9763, 0x20e6, 0x1207, 0x05d4, 0x3737, 0x0822, 0x2683, 0x3007,
+	0x7645, 0x167d, 0x1207, 0x05e0, 0x8ef1, 0x2023, 0x30d7, 0x2683,
+	0x2807, 0xe693, 0x1207, 0x05ec, 0x1006, 0x2023, 0x28d7, 0x2683,
+	0x3807, 0xe693, 0x1207, 0x05f8, 0x1006, 0x2023, 0x38d7, 0x2683,
+	0x4007, 0xe693, 0x1207, 0x0604, 0x1006, 0x2023, 0x40d7, 0x2683,
+	0x4807, 0xe693, 0x1207, 0x0610, 0x1006, 0x2023, 0x48d7, 0x56b7,
+	0x0800, 0xa703, 0x1207, 0x061c, 0x3486, 0x830d, 0x8b05, 0xcf01,
+	0xa703, 0x5c46, 0x1207, 0x0628, 0x7671, 0x167d, 0x8f71, 0x6611,
+	0xa223, 0x5ce6, 0x1207, 0x0634, 0x8f51, 0xa223, 0x5ce6, 0x2703,
+	0x1084, 0x46b2, 0x1207, 0x0640, 0x1c63, 0x02d7, 0x3737, 0x0822,
+	0x2683, 0x2807, 0x1207, 0x064c, 0xe693, 0x0016, 0x2023, 0x28d7,
+	0x2683, 0x3807, 0x1207, 0x0658, 0xe693, 0x0016, 0x2023, 0x38d7,
+	0x2683, 0x4007, 0x1207, 0x0664, 0xe693, 0x0016, 0x2023, 0x40d7,
+	0x2683, 0x4807, 0x1207, 0x0670, 0xe693, 0x0016, 0x2023, 0x48d7,
+	0x2703, 0x1004, 0x1207, 0x067c, 0x46b2, 0x9c63, 0x1ae6, 0x0737,
+	0x0800, 0x4b78, 0x1207, 0x0688, 0x0693, 0x0ff0, 0x463d, 0x8b1d,
+	0xce3a, 0x52b7, 0x1207, 0x0694, 0x0800, 0x4701, 0x4389, 0x408d,
+	0x4311, 0x0537, 0x1207, 0x06a0, 0x0820, 0x1593, 0x0077, 0x95aa,
+	0x418c, 0x4572, 0x1207, 0x06ac, 0x05c2, 0x81c1, 0x81a9, 0x7763,
+	0x00b5, 0x9533, 0x1207, 0x06b8, 0x00e4, 0x4513, 0xfff5, 0x8e69,
+	0x0537, 0x0800, 0x1207, 0x06c4, 0x4568, 0x8121, 0x893d, 0x7463,
+	0x02b5, 0xa583, 0x1207, 0x06d0, 0x06c2, 0x0763, 0x1277, 0x0a63,
+	0x1217, 0x05c2, 0x1207, 0x06dc, 0x81c1, 0x818d, 0x0d63, 0x1097,
+	0x8985, 0x0586, 0x1207, 0x06e8, 0x95b3, 0x00b4, 0xc593, 0xfff5,
+	0x8eed, 0x0705, 0x1207, 0x06f4, 0x15e3, 0xfa67, 0x35b7, 0x0822,
+	0xa703, 0x3005, 0x1207, 0x0700, 0x757d, 0x8a3d, 0x0513, 0x0ff5,
+	0x8f69, 0x0622, 0x1207, 0x070c, 0x8e59, 0xa023, 0x30c5, 0x8637,
+	0x0800, 0x5a38, 0x1207, 0x0718, 0x75c1, 0xf693, 0x0ff6, 0x8593,
+	0x0ff5, 0x8f6d, 0x1207, 0x0724, 0x06a2, 0x8ed9, 0xda34, 0x4682,
+	0x0713, 0x0210, 0x1207, 0x0730, 0x9163, 0x0ee6, 0x4711, 0xe391,
+	0x471d, 0x2023, 0x1207, 0x073c, 0x10e4, 0x2683, 0x0a04, 0x471d,
+	0x9e63, 0x00e6, 0x1207, 0x0748, 0x6737, 0x0800, 0x2703, 0x4cc7,
+	0x0693, 0x4000, 0x1207, 0x0754, 0x7713, 0x4807, 0x1463, 0x00d7,
+	0x2223, 0x0e04, 0x1207, 0x0760, 0x4018, 0x1163, 0x0497, 0x5703,
+	0x00c4, 0x1793, 0x1207, 0x076c, 0x0117, 0xdb63, 0x0207, 0x8737,
+	0x0800, 0x4778, 0x1207, 0x0778, 0x7713, 0x0807, 0xe705, 0x0513,
+	0x0000, 0x4792, 0x1207, 0x0784, 0x4581, 0x9782, 0x47a2, 0x4711,
+	0xc818, 0xc004, 0x1207, 0x0790, 0x0d23, 0x0094, 0x0ca3, 0x0004,
+	0x9782, 0x56b7, 0x1207, 0x079c, 0x0800, 0x42b8, 0x9b71, 0xc2b8,
+	0x0513, 0x0000, 0x1207, 0x07a8, 0x47d2, 0x9782, 0x4703, 0x2684,
+	0x03e3, 0xde07, 0x1207, 0x07b4, 0xbbd9, 0x07b7, 0x0002, 0x8793,
+	0x65c7, 0xc83e, 0x1207, 0x07c0, 0x27b7, 0x0002, 0x8793, 0xdae7,
+	0xc43e, 0x47b7, 0x1207, 0x07cc, 0x0002, 0x8793, 0x1427, 0xc23e,
+	0x57b7, 0x0002, 0x1207, 0x07d8, 0x8793, 0x9867, 0xb1fd, 0x2683,
+	0x1504, 0x4709, 0x1207, 0x07e4, 0x99e3, 0xe2e6, 0x36b7, 0x0822,
+	0xa703, 0x3006, 0x1207, 0x07f0, 0x663d, 0x8f51, 0xa023, 0x30e6,
+	0xbd39, 0xc593, 0x1207, 0x07fc, 0x0015, 0xb5dd, 0x8991, 0x35b3,
+	0x00b0, 0x0589, 0x1207, 0x0808, 0xbdf9, 0x8991, 0xb593, 0x0015,
+	0xbfdd, 0x0737, 0x1207, 0x0814, 0x0800, 0x4f28, 0xcf89, 0x47c2,
+	0x893d, 0x9782, 0x1207, 0x0820, 0x47e2, 0x0713, 0x1000, 0x2223,
+	0x10e4, 0x2423, 0x1207, 0x082c, 0x10f4, 0x474d, 0xb729, 0x8111,
+	0xb7dd, 0x14e3, 0x1207, 0x0838, 0xf097, 0x0737, 0x0800, 0x4770,
+	0x1713, 0x0106, 0x1207, 0x0844, 0x5d63, 0x0607, 0x85b7, 0x0800,
+	0xa683, 0x0d05, 0x1207, 0x0850, 0x72c5, 0x7313, 0x00f6, 0x12fd,
+	0xa703, 0x0d45, 0x1207, 0x085c, 0x1513, 0x00c3, 0xf6b3, 0x0056,
+	0x8ec9, 0x757d, 0x1207, 0x0868, 0x0393, 0x0ff5, 0x1293, 0x0083,
+	0xf6b3, 0x0076, 0x1207, 0x0874, 0x9b41, 0x8211, 0xe2b3, 0x0056,
+	0x1093, 0x0043, 0x1207, 0x0880, 0x7693, 0x0016, 0x6333, 0x0067,
+	0x0613, 0x7ff5, 0x1207, 0x088c, 0x9713, 0x00b6, 0x7633, 0x00c3,
+	0x8e59, 0x9513, 0x1207, 0x0898, 0x00a6, 0x7613, 0x9ff6, 0x9713,
+	0x0096, 0x8e49, 0x1207, 0x08a4, 0xf293, 0xf0f2, 0x8e59, 0xe2b3,
+	0x0012, 0x06a2, 0x1207, 0x08b0, 0x7613, 0xeff6, 0x8e55, 0xa823,
+	0x0c55, 0xaa23, 0x1207, 0x08bc, 0x0cc5, 0x80e3, 0xe807, 0x46b7,
+	0x0822, 0xa703, 0x1207, 0x08c8, 0xf006, 0x9b61, 0x6713, 0x0027,
+	0xa023, 0xf0e6, 0x1207, 0x08d4, 0xb5ad, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x1102, 0x0000, 0x0400, 0x1001, 0x4000, 0x1f01,
+	0x0000,
 };
 
 static const u16 patch_version1 = 0x9f73;
-static const u32 init_data1[] = {
-	0x1f00a0, 0x1903f3, 0x1f0012, 0x150100, 0x1f00ad, 0x100000,
-	0x11e0c6, 0x1f00a0, 0x1903fb, 0x1903fb, 0x1903fb, 0x1903fb,
-	0x1903fb, 0x1903fb, 0x1903fb, 0x1903fb, 0x1f00ad, 0x110000,
-	0x120400, 0x130093, 0x140000, 0x150193, 0x160000, 0x170213,
-	0x180000, 0x12040c, 0x130293, 0x140000, 0x150313, 0x160000,
-	0x170393, 0x180000, 0x120418, 0x130413, 0x140000, 0x150493,
-	0x160000, 0x170513, 0x180000, 0x120424, 0x130593, 0x140000,
-	0x150613, 0x160000, 0x170693, 0x180000, 0x120430, 0x130713,
-	0x140000, 0x150793, 0x160000, 0x171137, 0x180000, 0x12043c,
-	0x13006f, 0x140060, 0x15a001, 0x161111, 0x17cc06, 0x18ca22,
-	0x120448, 0x13c826, 0x1417b7, 0x150800, 0x16aa23, 0x179407,
-	0x180713, 0x120454, 0x1330f0, 0x1467b7, 0x150800, 0x16a423,
-	0x1746e7, 0x18a703, 0x120460, 0x13a587, 0x146685, 0x158f55,
-	0x16ac23, 0x17a4e7, 0x1867a9, 0x12046c, 0x135737, 0x140800,
-	0x158793, 0x16f737, 0x172023, 0x1874f7, 0x120478, 0x1307b7,
-	0x140800, 0x155bf8, 0x165793, 0x170037, 0x18f793, 0x120484,
-	0x131f07, 0x147713, 0x1507f7, 0x168fd9, 0x170713, 0x180210,
-	0x120490, 0x138763, 0x1400e7, 0x150713, 0x160270, 0x178263,
-	0x181ce7, 0x12049c, 0x13a001, 0x141437, 0x150002, 0x160793,
-	0x17e564, 0x18c43e, 0x1204a8, 0x1337b7, 0x140002, 0x158793,
-	0x166867, 0x17c23e, 0x1847b7, 0x1204b4, 0x130002, 0x148793,
-	0x15e9a7, 0x16c63e, 0x1767b7, 0x180800, 0x1204c0, 0x13a703,
-	0x146d87, 0x1576c1, 0x168693, 0x170ff6, 0x188f75, 0x1204cc,
-	0x1366b5, 0x148693, 0x158006, 0x168f55, 0x17ac23, 0x186ce7,
-	0x1204d8, 0x13a703, 0x1465c7, 0x1556b7, 0x160800, 0x177713,
-	0x18f0f7, 0x1204e4, 0x136713, 0x140807, 0x15ae23, 0x1664e7,
-	0x17a703, 0x185c46, 0x1204f0, 0x130413, 0x140000, 0x159b75,
-	0x16a223, 0x175ce6, 0x18a703, 0x1204fc, 0x13f5c7, 0x146691,
-	0x158f55, 0x16ae23, 0x17f4e7, 0x180737, 0x120508, 0x130809,
-	0x14433c, 0x158fd5, 0x16c33c, 0x170793, 0x180000, 0x120514,
-	0x130713, 0x141000, 0x159c23, 0x1624e7, 0x170713, 0x181010,
-	0x120520, 0x138d23, 0x142407, 0x159123, 0x1626e7, 0x17a223,
-	0x182607, 0x12052c, 0x13c026, 0x144782, 0x154581, 0x164485,
-	0x170513, 0x180000, 0x120538, 0x134792, 0x149782, 0x154018,
-	0x161775, 0x17e563, 0x1802e4, 0x120544, 0x132703, 0x140a04,
-	0x151163, 0x160297, 0x174818, 0x180563, 0x120550, 0x130097,
-	0x1447a2, 0x15c804, 0x169782, 0x176637, 0x180800, 0x12055c,
-	0x132703, 0x144c46, 0x159b71, 0x166713, 0x170027, 0x182223,
-	0x120568, 0x134ce6, 0x144703, 0x150fd4, 0x16c739, 0x172603,
-	0x181004, 0x120574, 0x134745, 0x141263, 0x1510e6, 0x163737,
-	0x170822, 0x182603, 0x120580, 0x133007, 0x1475c5, 0x1515fd,
-	0x168e6d, 0x172023, 0x1830c7, 0x12058c, 0x132603, 0x142807,
-	0x156613, 0x161006, 0x172023, 0x1828c7, 0x120598, 0x132603,
-	0x143807, 0x156613, 0x161006, 0x172023, 0x1838c7, 0x1205a4,
-	0x132603, 0x144007, 0x156613, 0x161006, 0x172023, 0x1840c7,
-	0x1205b0, 0x132603, 0x144807, 0x156613, 0x161006, 0x172023,
-	0x1848c7, 0x1205bc, 0x135637, 0x140800, 0x152703, 0x163486,
-	0x17830d, 0x188b05, 0x1205c8, 0x13cf01, 0x142703, 0x155c46,
-	0x1675f1, 0x1715fd, 0x188f6d, 0x1205d4, 0x136591, 0x142223,
-	0x155ce6, 0x168f4d, 0x172223, 0x185ce6, 0x1205e0, 0x132603,
-	0x140a04, 0x15471d, 0x161e63, 0x1700e6, 0x186737, 0x1205ec,
-	0x130800, 0x142703, 0x154cc7, 0x160613, 0x174000, 0x187713,
-	0x1205f8, 0x134807, 0x141463, 0x1500c7, 0x162223, 0x170e04,
-	0x184018, 0x120604, 0x131263, 0x140497, 0x155703, 0x1600c4,
-	0x171793, 0x180117, 0x120610, 0x13dc63, 0x140207, 0x158737,
-	0x160800, 0x174778, 0x187713, 0x12061c, 0x130807, 0x14e70d,
-	0x154782, 0x164581, 0x170513, 0x180000, 0x120628, 0x134792,
-	0x149782, 0x1547a2, 0x164711, 0x17c818, 0x18c004, 0x120634,
-	0x130d23, 0x140094, 0x150ca3, 0x160004, 0x179782, 0x185637,
-	0x120640, 0x130800, 0x144238, 0x159b71, 0x16c238, 0x174782,
-	0x180513, 0x12064c, 0x130000, 0x1447b2, 0x159782, 0x164703,
-	0x172684, 0x1803e3, 0x120658, 0x13ee07, 0x14bdd1, 0x152437,
-	0x160002, 0x170793, 0x18dae4, 0x120664, 0x13c43e, 0x1447b7,
-	0x150002, 0x168793, 0x171427, 0x18c23e, 0x120670, 0x1357b7,
-	0x140002, 0x158793, 0x169867, 0x17b589, 0x182603, 0x12067c,
-	0x131504, 0x144709, 0x151ee3, 0x16f2e6, 0x173637, 0x180822,
-	0x120688, 0x132703, 0x143006, 0x1565bd, 0x168f4d, 0x172023,
-	0x1830e6, 0x120694, 0x13b725, 0x140000, 0x150000, 0x160000,
-	0x170000, 0x180000, 0x110000, 0x120400, 0x104000, 0x1f0000,
+static const u16 init_data1[] = {
+	0x1f01, 0x00a0, 0x1901, 0x03f3, 0x1f01, 0x0012, 0x1501, 0x0100,
+	0x1f01, 0x00ad, 0x1002, 0x0000, 0xe0c6, 0x1f01, 0x00a0, 0x1901,
+	0x03fb, 0x1901, 0x03fb, 0x1901, 0x03fb, 0x1901, 0x03fb, 0x1901,
+	0x03fb, 0x1901, 0x03fb, 0x1901, 0x03fb, 0x1901, 0x03fb, 0x1f01,
+	0x00ad, 0x1108, 0x0000, 0x0400, 0x0093, 0x0000, 0x0193, 0x0000,
+	0x0213, 0x0000, 0x1207, 0x040c, 0x0293, 0x0000, 0x0313, 0x0000,
+	0x0393, 0x0000, 0x1207, 0x0418, 0x0413, 0x0000, 0x0493, 0x0000,
+	0x0513, 0x0000, 0x1207, 0x0424, 0x0593, 0x0000, 0x0613, 0x0000,
+	0x0693, 0x0000, 0x1207, 0x0430, 0x0713, 0x0000, 0x0793, 0x0000,
+	0x1137, 0x0000, 0x1207, 0x043c, 0x006f, 0x0060, 0xa001, 0x1111,
+	0xcc06, 0xca22, 0x1207, 0x0448, 0xc826, 0x17b7, 0x0800, 0xaa23,
+	0x9407, 0x0713, 0x1207, 0x0454, 0x30f0, 0x67b7, 0x0800, 0xa423,
+	0x46e7, 0xa703, 0x1207, 0x0460, 0xa587, 0x6685, 0x8f55, 0xac23,
+	0xa4e7, 0x67a9, 0x1207, 0x046c, 0x5737, 0x0800, 0x8793, 0xf737,
+	0x2023, 0x74f7, 0x1207, 0x0478, 0x07b7, 0x0800, 0x5bf8, 0x5793,
+	0x0037, 0xf793, 0x1207, 0x0484, 0x1f07, 0x7713, 0x07f7, 0x8fd9,
+	0x0713, 0x0210, 0x1207, 0x0490, 0x8763, 0x00e7, 0x0713, 0x0270,
+	0x8263, 0x1ce7, 0x1207, 0x049c, 0xa001, 0x1437, 0x0002, 0x0793,
+	0xe564, 0xc43e, 0x1207, 0x04a8, 0x37b7, 0x0002, 0x8793, 0x6867,
+	0xc23e, 0x47b7, 0x1207, 0x04b4, 0x0002, 0x8793, 0xe9a7, 0xc63e,
+	0x67b7, 0x0800, 0x1207, 0x04c0, 0xa703, 0x6d87, 0x76c1, 0x8693,
+	0x0ff6, 0x8f75, 0x1207, 0x04cc, 0x66b5, 0x8693, 0x8006, 0x8f55,
+	0xac23, 0x6ce7, 0x1207, 0x04d8, 0xa703, 0x65c7, 0x56b7, 0x0800,
+	0x7713, 0xf0f7, 0x1207, 0x04e4, 0x6713, 0x0807, 0xae23, 0x64e7,
+	0xa703, 0x5c46, 0x1207, 0x04f0, 0x0413, 0x0000, 0x9b75, 0xa223,
+	0x5ce6, 0xa703, 0x1207, 0x04fc, 0xf5c7, 0x6691, 0x8f55, 0xae23,
+	0xf4e7, 0x0737, 0x1207, 0x0508, 0x0809, 0x433c, 0x8fd5, 0xc33c,
+	0x0793, 0x0000, 0x1207, 0x0514, 0x0713, 0x1000, 0x9c23, 0x24e7,
+	0x0713, 0x1010, 0x1207, 0x0520, 0x8d23, 0x2407, 0x9123, 0x26e7,
+	0xa223, 0x2607, 0x1207, 0x052c, 0xc026, 0x4782, 0x4581, 0x4485,
+	0x0513, 0x0000, 0x1207, 0x0538, 0x4792, 0x9782, 0x4018, 0x1775,
+	0xe563, 0x02e4, 0x1207, 0x0544, 0x2703, 0x0a04, 0x1163, 0x0297,
+	0x4818, 0x0563, 0x1207, 0x0550, 0x0097, 0x47a2, 0xc804, 0x9782,
+	0x6637, 0x0800, 0x1207, 0x055c, 0x2703, 0x4c46, 0x9b71, 0x6713,
+	0x0027, 0x2223, 0x1207, 0x0568, 0x4ce6, 0x4703, 0x0fd4, 0xc739,
+	0x2603, 0x1004, 0x1207, 0x0574, 0x4745, 0x1263, 0x10e6, 0x3737,
+	0x0822, 0x2603, 0x1207, 0x0580, 0x3007, 0x75c5, 0x15fd, 0x8e6d,
+	0x2023, 0x30c7, 0x1207, 0x058c, 0x2603, 0x2807, 0x6613, 0x1006,
+	0x2023, 0x28c7, 0x1207, 0x0598, 0x2603, 0x3807, 0x6613, 0x1006,
+	0x2023, 0x38c7, 0x1207, 0x05a4, 0x2603, 0x4007, 0x6613, 0x1006,
+	0x2023, 0x40c7, 0x1207, 0x05b0, 0x2603, 0x4807, 0x6613, 0x1006,
+	0x2023, 0x48c7, 0x1207, 0x05bc, 0x5637, 0x0800, 0x2703, 0x3486,
+	0x830d, 0x8b05, 0x1207, 0x05c8, 0xcf01, 0x2703, 0x5c46, 0x75f1,
+	0x15fd, 0x8f6d, 0x1207, 0x05d4, 0x6591, 0x2223, 0x5ce6, 0x8f4d,
+	0x2223, 0x5ce6, 0x1207, 0x05e0, 0x2603, 0x0a04, 0x471d, 0x1e63,
+	0x00e6, 0x6737, 0x1207, 0x05ec, 0x0800, 0x2703, 0x4cc7, 0x0613,
+	0x4000, 0x7713, 0x1207, 0x05f8, 0x4807, 0x1463, 0x00c7, 0x2223,
+	0x0e04, 0x4018, 0x1207, 0x0604, 0x1263, 0x0497, 0x5703, 0x00c4,
+	0x1793, 0x0117, 0x1207, 0x0610, 0xdc63, 0x0207, 0x8737, 0x0800,
+	0x4778, 0x7713, 0x1207, 0x061c, 0x0807, 0xe70d, 0x4782, 0x4581,
+	0x0513, 0x0000, 0x1207, 0x0628, 0x4792, 0x9782, 0x47a2, 0x4711,
+	0xc818, 0xc004, 0x1207, 0x0634, 0x0d23, 0x0094, 0x0ca3, 0x0004,
+	0x9782, 0x5637, 0x1207, 0x0640, 0x0800, 0x4238, 0x9b71, 0xc238,
+	0x4782, 0x0513, 0x1207, 0x064c, 0x0000, 0x47b2, 0x9782, 0x4703,
+	0x2684, 0x03e3, 0x1207, 0x0658, 0xee07, 0xbdd1, 0x2437, 0x0002,
+	0x0793, 0xdae4, 0x1207, 0x0664, 0xc43e, 0x47b7, 0x0002, 0x8793,
+	0x1427, 0xc23e, 0x1207, 0x0670, 0x57b7, 0x0002, 0x8793, 0x9867,
+	0xb589, 0x2603, 0x1207, 0x067c, 0x1504, 0x4709, 0x1ee3, 0xf2e6,
+	0x3637, 0x0822, 0x1207, 0x0688, 0x2703, 0x3006, 0x65bd, 0x8f4d,
+	0x2023, 0x30e6, 0x1207, 0x0694, 0xb725, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x1102, 0x0000, 0x0400, 0x1001, 0x4000, 0x1f01,
+	0x0000,
 };
 
 static const u16 patch_version2 = 0x2e9c;
-static const u32 init_data2[] = {
-	0x1f00a0, 0x1903f3, 0x1f0012, 0x150100, 0x1f00ad, 0x100000,
-	0x11e0c6, 0x1f0102, 0x199000, 0x1f00a0, 0x1903fb, 0x1903fb,
-	0x1903fb, 0x1903fb, 0x1903fb, 0x1903fb, 0x1903fb, 0x1903fb,
-	0x1f00ad, 0x110000, 0x121000, 0x13937c, 0x140120, 0x15675e,
-	0x16fca8, 0x1706b7, 0x180800, 0x12100c, 0x135af8, 0x145793,
-	0x150037, 0x16f793, 0x171f07, 0x187713, 0x121018, 0x1307f7,
-	0x148fd9, 0x150713, 0x1606a0, 0x179b63, 0x1808e7, 0x121024,
-	0x13cd19, 0x141121, 0x15c822, 0x16ca06, 0x17c626, 0x184789,
-	0x121030, 0x13842e, 0x140963, 0x152cf5, 0x1640d2, 0x174442,
-	0x1844b2, 0x12103c, 0x134501, 0x140161, 0x158082, 0x1617b7,
-	0x170800, 0x18aa23, 0x121048, 0x139407, 0x1467b7, 0x150800,
-	0x16a703, 0x17a587, 0x186605, 0x121054, 0x138f51, 0x14ac23,
-	0x15a4e7, 0x16670d, 0x170713, 0x18e9c7, 0x121060, 0x135637,
-	0x140800, 0x152023, 0x1674e6, 0x174ab8, 0x186713, 0x12106c,
-	0x130407, 0x14cab8, 0x15a703, 0x164d47, 0x1776fd, 0x188693,
-	0x121078, 0x1303f6, 0x148f75, 0x156713, 0x162807, 0x17aa23,
-	0x184ce7, 0x121084, 0x13a703, 0x147587, 0x157713, 0x16e1f7,
-	0x176713, 0x180607, 0x121090, 0x13ac23, 0x1474e7, 0x15a703,
-	0x164f47, 0x177713, 0x18f0f7, 0x12109c, 0x136713, 0x140107,
-	0x15aa23, 0x164ee7, 0x17a703, 0x18fc07, 0x1210a8, 0x139b5d,
-	0x14a023, 0x15fce7, 0x160713, 0x170300, 0x18a223, 0x1210b4,
-	0x13a6e7, 0x144501, 0x158082, 0x166489, 0x179023, 0x180004,
-	0x1210c0, 0x134505, 0x142ebd, 0x1557fd, 0x16c49c, 0x17c4dc,
-	0x184783, 0x1210cc, 0x130ec4, 0x149363, 0x152407, 0x16b795,
-	0x1787b7, 0x180800, 0x1210d8, 0x13a583, 0x140dc7, 0x15a783,
-	0x160e07, 0x178b91, 0x188063, 0x1210e4, 0x131807, 0x14d793,
-	0x150085, 0x1681b9, 0x178bbd, 0x188985, 0x1210f0, 0x1386b7,
-	0x140800, 0x15a703, 0x160d06, 0x17833e, 0x189513, 0x1210fc,
-	0x1300c7, 0x1477c5, 0x1517fd, 0x168f7d, 0x178f49, 0x18757d,
-	0x121108, 0x130293, 0x140ff5, 0x15a603, 0x160d46, 0x171793,
-	0x180083, 0x121114, 0x137733, 0x140057, 0x158f5d, 0x167713,
-	0x17f0f7, 0x181793, 0x121120, 0x130043, 0x148f5d, 0x157793,
-	0x16ff06, 0x170513, 0x187ff5, 0x12112c, 0x13e7b3, 0x140067,
-	0x159613, 0x1600b5, 0x178fe9, 0x188fd1, 0x121138, 0x139513,
-	0x1400a5, 0x15f793, 0x169ff7, 0x179613, 0x180095, 0x121144,
-	0x138fc9, 0x148fd1, 0x1505a2, 0x16f793, 0x17eff7, 0x188fcd,
-	0x121150, 0x13a823, 0x140ce6, 0x15aa23, 0x160cf6, 0x172783,
-	0x180f04, 0x12115c, 0x134719, 0x148563, 0x1500e7, 0x16472d,
-	0x179263, 0x1810e7, 0x121168, 0x130493, 0x141104, 0x154701,
-	0x164781, 0x17d683, 0x180104, 0x121174, 0x13e2b5, 0x1446a1,
-	0x154701, 0x16853e, 0x17c436, 0x18c23a, 0x121180, 0x13c03e,
-	0x142ca9, 0x1546a2, 0x164712, 0x174782, 0x1816fd, 0x12118c,
-	0x13972a, 0x14f6f5, 0x150637, 0x160820, 0x175693, 0x184037,
-	0x121198, 0x139713, 0x140077, 0x159732, 0x164310, 0x17d703,
-	0x180004, 0x1211a4, 0x139963, 0x1422e6, 0x159593, 0x160017,
-	0x176709, 0x18972e, 0x1211b0, 0x135703, 0x140087, 0x157e63,
-	0x1600e6, 0x17d703, 0x180184, 0x1211bc, 0x139023, 0x1400d4,
-	0x159693, 0x160017, 0x179423, 0x1800e4, 0x1211c8, 0x136709,
-	0x149736, 0x151423, 0x1600c7, 0x17d703, 0x180184, 0x1211d4,
-	0x133713, 0x140017, 0x150785, 0x164691, 0x170489, 0x1899e3,
-	0x1211e0, 0x13f8d7, 0x1447b5, 0x151f63, 0x161807, 0x176785,
-	0x1897a2, 0x1211ec, 0x13a703, 0x14a687, 0x154791, 0x160b63,
-	0x1718f7, 0x186489, 0x1211f8, 0x13d783, 0x140004, 0x159de3,
-	0x16e207, 0x172703, 0x180f04, 0x121204, 0x134789, 0x1418e3,
-	0x15e2f7, 0x164505, 0x172c15, 0x185637, 0x121210, 0x130800,
-	0x1446b7, 0x150822, 0x164238, 0x17a783, 0x18f806, 0x12121c,
-	0x133537, 0x140822, 0x1575c1, 0x16f793, 0x178ff7, 0x18e793,
-	0x121228, 0x133007, 0x14a023, 0x15f8f6, 0x162683, 0x173805,
-	0x188593, 0x121234, 0x130ff5, 0x14d793, 0x150086, 0x168b85,
-	0x17e793, 0x180767, 0x121240, 0x138eed, 0x1407a2, 0x158fd5,
-	0x162023, 0x1738f5, 0x187793, 0x12124c, 0x13ffd7, 0x14c23c,
-	0x15e793, 0x160027, 0x17c23c, 0x1847c1, 0x121258, 0x139023,
-	0x1400f4, 0x154501, 0x1622cd, 0x17bbd9, 0x184585, 0x121264,
-	0x134791, 0x14b569, 0x15476d, 0x169fe3, 0x17f6e7, 0x180737,
-	0x121270, 0x130002, 0x144481, 0x150713, 0x160a67, 0x178793,
-	0x184b84, 0x12127c, 0x130786, 0x1497a2, 0x15d683, 0x160ee7,
-	0x178526, 0x180485, 0x121288, 0x13e693, 0x140026, 0x159723,
-	0x160ed7, 0x179702, 0x180737, 0x121294, 0x130002, 0x144791,
-	0x150713, 0x160a67, 0x179ee3, 0x18fcf4, 0x1212a0, 0x130493,
-	0x141000, 0x154501, 0x1614fd, 0x172a15, 0x18fced, 0x1212ac,
-	0x134785, 0x148526, 0x15c03e, 0x16222d, 0x17470d, 0x184782,
-	0x1212b8, 0x135363, 0x1400a7, 0x154781, 0x160485, 0x174711,
-	0x1896e3, 0x1212c4, 0x13fee4, 0x14c38d, 0x156789, 0x164749,
-	0x179023, 0x1800e7, 0x1212d0, 0x1347c5, 0x142c23, 0x150ef4,
-	0x160793, 0x171000, 0x182a23, 0x1212dc, 0x130ef4, 0x1445d1,
-	0x150513, 0x160ec4, 0x172a15, 0x18b709, 0x1212e8, 0x136705,
-	0x149722, 0x155783, 0x16a5a7, 0x1746a1, 0x180785, 0x1212f4,
-	0x1307c2, 0x1483c1, 0x15f963, 0x1602f6, 0x171d23, 0x18a407,
-	0x121300, 0x132823, 0x140e04, 0x154783, 0x160ec4, 0x1789e3,
-	0x18da07, 0x12130c, 0x132783, 0x140f04, 0x1585e3, 0x16da07,
-	0x172783, 0x180f04, 0x121318, 0x138ee3, 0x14da07, 0x154741,
-	0x169de3, 0x17e2e7, 0x1847ed, 0x121324, 0x132823, 0x140ef4,
-	0x15bd05, 0x1606b7, 0x170002, 0x181d23, 0x121330, 0x13a4f7,
-	0x144481, 0x158693, 0x160a66, 0x178793, 0x184b84, 0x12133c,
-	0x130786, 0x1497a2, 0x15d703, 0x160ee7, 0x178526, 0x189b75,
-	0x121348, 0x139723, 0x140ee7, 0x159682, 0x160737, 0x170820,
-	0x189793, 0x121354, 0x130074, 0x140713, 0x152007, 0x1697ba,
-	0x17a023, 0x180007, 0x121360, 0x130737, 0x140002, 0x150485,
-	0x164791, 0x170693, 0x180a67, 0x12136c, 0x1396e3, 0x14fcf4,
-	0x150737, 0x160828, 0x172783, 0x184807, 0x121378, 0x13e793,
-	0x140207, 0x152023, 0x1648f7, 0x1747b9, 0x182823, 0x121384,
-	0x130ef4, 0x14b58d, 0x156709, 0x165683, 0x170007, 0x1847c9,
-	0x121390, 0x1393e3, 0x14e6f6, 0x1547b7, 0x160800, 0x17a783,
-	0x180c87, 0x12139c, 0x130693, 0x141000, 0x1507c2, 0x1683c1,
-	0x17f663, 0x1802f6, 0x1213a8, 0x135783, 0x140027, 0x150785,
-	0x1607c2, 0x1783c1, 0x181123, 0x1213b4, 0x1300f7, 0x144725,
-	0x157fe3, 0x16c6f7, 0x1766b7, 0x180800, 0x1213c0, 0x13a783,
-	0x14f5c6, 0x157779, 0x16177d, 0x178ff9, 0x18ae23, 0x1213cc,
-	0x13f4f6, 0x14b1a5, 0x151123, 0x160007, 0x17b18d, 0x18c1e3,
-	0x1213d8, 0x13dee6, 0x14bbdd, 0x150737, 0x160830, 0x172783,
-	0x181807, 0x1213e4, 0x132703, 0x142007, 0x154685, 0x160263,
-	0x1702d5, 0x18c763, 0x1213f0, 0x1300a6, 0x148bfd, 0x15c111,
-	0x164781, 0x17853e, 0x188082, 0x1213fc, 0x134689, 0x140b63,
-	0x1500d5, 0x16478d, 0x1719e3, 0x18fef5, 0x121408, 0x135793,
-	0x140047, 0x15a011, 0x168395, 0x178bfd, 0x18b7dd, 0x121414,
-	0x1383a9, 0x14bfed, 0x151141, 0x16c422, 0x17c606, 0x1847d1,
-	0x121420, 0x13842a, 0x149a63, 0x1500f5, 0x164508, 0x1707b7,
-	0x180002, 0x12142c, 0x13c02e, 0x148793, 0x156687, 0x169782,
-	0x174582, 0x18c04c, 0x121438, 0x1340b2, 0x144422, 0x150141,
-	0x168082, 0x17ed09, 0x184781, 0x121444, 0x134737, 0x140822,
-	0x152023, 0x16d0f7, 0x172023, 0x18d8f7, 0x121450, 0x132023,
-	0x14e0f7, 0x152023, 0x16e8f7, 0x178082, 0x186785, 0x12145c,
-	0x133737, 0x140822, 0x158693, 0x16fff7, 0x172023, 0x1830d7,
-	0x121468, 0x132023, 0x145007, 0x152023, 0x165807, 0x172023,
-	0x186007, 0x121474, 0x132023, 0x146807, 0x158793, 0x16c007,
-	0x17b7e1, 0x180000, 0x1f00a0, 0x1903f3, 0x1903fb, 0x1f0000,
+static const u16 init_data2[] = {
+	0x1f01, 0x00a0, 0x1901, 0x03f3, 0x1f01, 0x0012, 0x1501, 0x0100,
+	0x1f01, 0x00ad, 0x1002, 0x0000, 0xe0c6, 0x1f01, 0x0102, 0x1901,
+	0x9000, 0x1f01, 0x00a0, 0x1901, 0x03fb, 0x1901, 0x03fb, 0x1901,
+	0x03fb, 0x1901, 0x03fb, 0x1901, 0x03fb, 0x1901, 0x03fb, 0x1901,
+	0x03fb, 0x1901, 0x03fb, 0x1f01, 0x00ad, 0x1108, 0x0000, 0x1000,
+	0x937c, 0x0120, 0x675e, 0xfca8, 0x06b7, 0x0800, 0x1207, 0x100c,
+	0x5af8, 0x5793, 0x0037, 0xf793, 0x1f07, 0x7713, 0x1207, 0x1018,
+	0x07f7, 0x8fd9, 0x0713, 0x06a0, 0x9b63, 0x08e7, 0x1207, 0x1024,
+	0xcd19, 0x1121, 0xc822, 0xca06, 0xc626, 0x4789, 0x1207, 0x1030,
+	0x842e, 0x0963, 0x2cf5, 0x40d2, 0x4442, 0x44b2, 0x1207, 0x103c,
+	0x4501, 0x0161, 0x8082, 0x17b7, 0x0800, 0xaa23, 0x1207, 0x1048,
+	0x9407, 0x67b7, 0x0800, 0xa703, 0xa587, 0x6605, 0x1207, 0x1054,
+	0x8f51, 0xac23, 0xa4e7, 0x670d, 0x0713, 0xe9c7, 0x1207, 0x1060,
+	0x5637, 0x0800, 0x2023, 0x74e6, 0x4ab8, 0x6713, 0x1207, 0x106c,
+	0x0407, 0xcab8, 0xa703, 0x4d47, 0x76fd, 0x8693, 0x1207, 0x1078,
+	0x03f6, 0x8f75, 0x6713, 0x2807, 0xaa23, 0x4ce7, 0x1207, 0x1084,
+	0xa703, 0x7587, 0x7713, 0xe1f7, 0x6713, 0x0607, 0x1207, 0x1090,
+	0xac23, 0x74e7, 0xa703, 0x4f47, 0x7713, 0xf0f7, 0x1207, 0x109c,
+	0x6713, 0x0107, 0xaa23, 0x4ee7, 0xa703, 0xfc07, 0x1207, 0x10a8,
+	0x9b5d, 0xa023, 0xfce7, 0x0713, 0x0300, 0xa223, 0x1207, 0x10b4,
+	0xa6e7, 0x4501, 0x8082, 0x6489, 0x9023, 0x0004, 0x1207, 0x10c0,
+	0x4505, 0x2ebd, 0x57fd, 0xc49c, 0xc4dc, 0x4783, 0x1207, 0x10cc,
+	0x0ec4, 0x9363, 0x2407, 0xb795, 0x87b7, 0x0800, 0x1207, 0x10d8,
+	0xa583, 0x0dc7, 0xa783, 0x0e07, 0x8b91, 0x8063, 0x1207, 0x10e4,
+	0x1807, 0xd793, 0x0085, 0x81b9, 0x8bbd, 0x8985, 0x1207, 0x10f0,
+	0x86b7, 0x0800, 0xa703, 0x0d06, 0x833e, 0x9513, 0x1207, 0x10fc,
+	0x00c7, 0x77c5, 0x17fd, 0x8f7d, 0x8f49, 0x757d, 0x1207, 0x1108,
+	0x0293, 0x0ff5, 0xa603, 0x0d46, 0x1793, 0x0083, 0x1207, 0x1114,
+	0x7733, 0x0057, 0x8f5d, 0x7713, 0xf0f7, 0x1793, 0x1207, 0x1120,
+	0x0043, 0x8f5d, 0x7793, 0xff06, 0x0513, 0x7ff5, 0x1207, 0x112c,
+	0xe7b3, 0x0067, 0x9613, 0x00b5, 0x8fe9, 0x8fd1, 0x1207, 0x1138,
+	0x9513, 0x00a5, 0xf793, 0x9ff7, 0x9613, 0x0095, 0x1207, 0x1144,
+	0x8fc9, 0x8fd1, 0x05a2, 0xf793, 0xeff7, 0x8fcd, 0x1207, 0x1150,
+	0xa823, 0x0ce6, 0xaa23, 0x0cf6, 0x2783, 0x0f04, 0x1207, 0x115c,
+	0x4719, 0x8563, 0x00e7, 0x472d, 0x9263, 0x10e7, 0x1207, 0x1168,
+	0x0493, 0x1104, 0x4701, 0x4781, 0xd683, 0x0104, 0x1207, 0x1174,
+	0xe2b5, 0x46a1, 0x4701, 0x853e, 0xc436, 0xc23a, 0x1207, 0x1180,
+	0xc03e, 0x2ca9, 0x46a2, 0x4712, 0x4782, 0x16fd, 0x1207, 0x118c,
+	0x972a, 0xf6f5, 0x0637, 0x0820, 0x5693, 0x4037, 0x1207, 0x1198,
+	0x9713, 0x0077, 0x9732, 0x4310, 0xd703, 0x0004, 0x1207, 0x11a4,
+	0x9963, 0x22e6, 0x9593, 0x0017, 0x6709, 0x972e, 0x1207, 0x11b0,
+	0x5703, 0x0087, 0x7e63, 0x00e6, 0xd703, 0x0184, 0x1207, 0x11bc,
+	0x9023, 0x00d4, 0x9693, 0x0017, 0x9423, 0x00e4, 0x1207, 0x11c8,
+	0x6709, 0x9736, 0x1423, 0x00c7, 0xd703, 0x0184, 0x1207, 0x11d4,
+	0x3713, 0x0017, 0x0785, 0x4691, 0x0489, 0x99e3, 0x1207, 0x11e0,
+	0xf8d7, 0x47b5, 0x1f63, 0x1807, 0x6785, 0x97a2, 0x1207, 0x11ec,
+	0xa703, 0xa687, 0x4791, 0x0b63, 0x18f7, 0x6489, 0x1207, 0x11f8,
+	0xd783, 0x0004, 0x9de3, 0xe207, 0x2703, 0x0f04, 0x1207, 0x1204,
+	0x4789, 0x18e3, 0xe2f7, 0x4505, 0x2c15, 0x5637, 0x1207, 0x1210,
+	0x0800, 0x46b7, 0x0822, 0x4238, 0xa783, 0xf806, 0x1207, 0x121c,
+	0x3537, 0x0822, 0x75c1, 0xf793, 0x8ff7, 0xe793, 0x1207, 0x1228,
+	0x3007, 0xa023, 0xf8f6, 0x2683, 0x3805, 0x8593, 0x1207, 0x1234,
+	0x0ff5, 0xd793, 0x0086, 0x8b85, 0xe793, 0x0767, 0x1207, 0x1240,
+	0x8eed, 0x07a2, 0x8fd5, 0x2023, 0x38f5, 0x7793, 0x1207, 0x124c,
+	0xffd7, 0xc23c, 0xe793, 0x0027, 0xc23c, 0x47c1, 0x1207, 0x1258,
+	0x9023, 0x00f4, 0x4501, 0x22cd, 0xbbd9, 0x4585, 0x1207, 0x1264,
+	0x4791, 0xb569, 0x476d, 0x9fe3, 0xf6e7, 0x0737, 0x1207, 0x1270,
+	0x0002, 0x4481, 0x0713, 0x0a67, 0x8793, 0x4b84, 0x1207, 0x127c,
+	0x0786, 0x97a2, 0xd683, 0x0ee7, 0x8526, 0x0485, 0x1207, 0x1288,
+	0xe693, 0x0026, 0x9723, 0x0ed7, 0x9702, 0x0737, 0x1207, 0x1294,
+	0x0002, 0x4791, 0x0713, 0x0a67, 0x9ee3, 0xfcf4, 0x1207, 0x12a0,
+	0x0493, 0x1000, 0x4501, 0x14fd, 0x2a15, 0xfced, 0x1207, 0x12ac,
+	0x4785, 0x8526, 0xc03e, 0x222d, 0x470d, 0x4782, 0x1207, 0x12b8,
+	0x5363, 0x00a7, 0x4781, 0x0485, 0x4711, 0x96e3, 0x1207, 0x12c4,
+	0xfee4, 0xc38d, 0x6789, 0x4749, 0x9023, 0x00e7, 0x1207, 0x12d0,
+	0x47c5, 0x2c23, 0x0ef4, 0x0793, 0x1000, 0x2a23, 0x1207, 0x12dc,
+	0x0ef4, 0x45d1, 0x0513, 0x0ec4, 0x2a15, 0xb709, 0x1207, 0x12e8,
+	0x6705, 0x9722, 0x5783, 0xa5a7, 0x46a1, 0x0785, 0x1207, 0x12f4,
+	0x07c2, 0x83c1, 0xf963, 0x02f6, 0x1d23, 0xa407, 0x1207, 0x1300,
+	0x2823, 0x0e04, 0x4783, 0x0ec4, 0x89e3, 0xda07, 0x1207, 0x130c,
+	0x2783, 0x0f04, 0x85e3, 0xda07, 0x2783, 0x0f04, 0x1207, 0x1318,
+	0x8ee3, 0xda07, 0x4741, 0x9de3, 0xe2e7, 0x47ed, 0x1207, 0x1324,
+	0x2823, 0x0ef4, 0xbd05, 0x06b7, 0x0002, 0x1d23, 0x1207, 0x1330,
+	0xa4f7, 0x4481, 0x8693, 0x0a66, 0x8793, 0x4b84, 0x1207, 0x133c,
+	0x0786, 0x97a2, 0xd703, 0x0ee7, 0x8526, 0x9b75, 0x1207, 0x1348,
+	0x9723, 0x0ee7, 0x9682, 0x0737, 0x0820, 0x9793, 0x1207, 0x1354,
+	0x0074, 0x0713, 0x2007, 0x97ba, 0xa023, 0x0007, 0x1207, 0x1360,
+	0x0737, 0x0002, 0x0485, 0x4791, 0x0693, 0x0a67, 0x1207, 0x136c,
+	0x96e3, 0xfcf4, 0x0737, 0x0828, 0x2783, 0x4807, 0x1207, 0x1378,
+	0xe793, 0x0207, 0x2023, 0x48f7, 0x47b9, 0x2823, 0x1207, 0x1384,
+	0x0ef4, 0xb58d, 0x6709, 0x5683, 0x0007, 0x47c9, 0x1207, 0x1390,
+	0x93e3, 0xe6f6, 0x47b7, 0x0800, 0xa783, 0x0c87, 0x1207, 0x139c,
+	0x0693, 0x1000, 0x07c2, 0x83c1, 0xf663, 0x02f6, 0x1207, 0x13a8,
+	0x5783, 0x0027, 0x0785, 0x07c2, 0x83c1, 0x1123, 0x1207, 0x13b4,
+	0x00f7, 0x4725, 0x7fe3, 0xc6f7, 0x66b7, 0x0800, 0x1207, 0x13c0,
+	0xa783, 0xf5c6, 0x7779, 0x177d, 0x8ff9, 0xae23, 0x1207, 0x13cc,
+	0xf4f6, 0xb1a5, 0x1123, 0x0007, 0xb18d, 0xc1e3, 0x1207, 0x13d8,
+	0xdee6, 0xbbdd, 0x0737, 0x0830, 0x2783, 0x1807, 0x1207, 0x13e4,
+	0x2703, 0x2007, 0x4685, 0x0263, 0x02d5, 0xc763, 0x1207, 0x13f0,
+	0x00a6, 0x8bfd, 0xc111, 0x4781, 0x853e, 0x8082, 0x1207, 0x13fc,
+	0x4689, 0x0b63, 0x00d5, 0x478d, 0x19e3, 0xfef5, 0x1207, 0x1408,
+	0x5793, 0x0047, 0xa011, 0x8395, 0x8bfd, 0xb7dd, 0x1207, 0x1414,
+	0x83a9, 0xbfed, 0x1141, 0xc422, 0xc606, 0x47d1, 0x1207, 0x1420,
+	0x842a, 0x9a63, 0x00f5, 0x4508, 0x07b7, 0x0002, 0x1207, 0x142c,
+	0xc02e, 0x8793, 0x6687, 0x9782, 0x4582, 0xc04c, 0x1207, 0x1438,
+	0x40b2, 0x4422, 0x0141, 0x8082, 0xed09, 0x4781, 0x1207, 0x1444,
+	0x4737, 0x0822, 0x2023, 0xd0f7, 0x2023, 0xd8f7, 0x1207, 0x1450,
+	0x2023, 0xe0f7, 0x2023, 0xe8f7, 0x8082, 0x6785, 0x1207, 0x145c,
+	0x3737, 0x0822, 0x8693, 0xfff7, 0x2023, 0x30d7, 0x1207, 0x1468,
+	0x2023, 0x5007, 0x2023, 0x5807, 0x2023, 0x6007, 0x1207, 0x1474,
+	0x2023, 0x6807, 0x8793, 0xc007, 0xb7e1, 0x0000, 0x1f01, 0x00a0,
+	0x1901, 0x03f3, 0x1901, 0x03fb, 0x1f01, 0x0000,
 };
 
 /* no patch_version, val default=0 */
 static const u16 patch_version3;
-static const u32 init_data3[] = {
-	0x1f00a0, 0x1903f3, 0x1f0012, 0x150100, 0x1f00ad, 0x100000,
-	0x11e0c6, 0x1f00a0, 0x1903fb, 0x1903fb, 0x1903fb, 0x1903fb,
-	0x1903fb, 0x1903fb, 0x1f0012, 0x150000, 0x1f00ad, 0x110000,
-	0x127c30, 0x138137, 0x140000, 0x15006f, 0x1600e0, 0x170000,
-	0x180000, 0x127c3c, 0x130000, 0x140000, 0x150000, 0x161161,
-	0x177601, 0x1895b7, 0x127c48, 0x13fffd, 0x146541, 0x1586b7,
-	0x160002, 0x17c222, 0x18c026, 0x127c54, 0x1307b7, 0x140002,
-	0x150613, 0x162b06, 0x178593, 0x183085, 0x127c60, 0x130293,
-	0x142900, 0x15157d, 0x168693, 0x1797c6, 0x188733, 0x127c6c,
-	0x1300b7, 0x148333, 0x1500c7, 0x16ec63, 0x1734e2, 0x184398,
-	0x127c78, 0x138f69, 0x140713, 0x152b07, 0x162023, 0x1700e3,
-	0x180791, 0x127c84, 0x1393e3, 0x14fed7, 0x1567a1, 0x16659d,
-	0x178793, 0x181377, 0x127c90, 0x132423, 0x142ef0, 0x158713,
-	0x166b75, 0x176785, 0x18ac23, 0x127c9c, 0x13eae7, 0x140737,
-	0x158693, 0x160713, 0x1770a7, 0x18ae23, 0x127ca8, 0x13eae7,
-	0x140737, 0x159737, 0x160713, 0x17a867, 0x18a023, 0x127cb4,
-	0x13ece7, 0x141737, 0x157737, 0x166789, 0x170713, 0x188f77,
-	0x127cc0, 0x13ae23, 0x140ce7, 0x150737, 0x16078a, 0x17a023,
-	0x180ee7, 0x127ccc, 0x130737, 0x14ffc7, 0x150713, 0x167137,
-	0x17a223, 0x180ee7, 0x127cd8, 0x133737, 0x147337, 0x150713,
-	0x162a37, 0x17ae23, 0x183ce7, 0x127ce4, 0x1302b7, 0x14050a,
-	0x150737, 0x160103, 0x17a023, 0x183e57, 0x127cf0, 0x130713,
-	0x143137, 0x15a223, 0x163ee7, 0x17668d, 0x188513, 0x127cfc,
-	0x137375, 0x1404b7, 0x150713, 0x16ae23, 0x17a0a6, 0x188313,
-	0x127d08, 0x1378a4, 0x1404b7, 0x1597ba, 0x16a023, 0x17a266,
-	0x188713, 0x127d14, 0x132474, 0x140437, 0x1577b7, 0x16a223,
-	0x17a2e6, 0x180313, 0x127d20, 0x130a74, 0x146711, 0x152c23,
-	0x16c667, 0x170337, 0x188793, 0x127d2c, 0x132e23, 0x14c667,
-	0x158293, 0x166072, 0x1703b7, 0x187737, 0x127d38, 0x132023,
-	0x14c857, 0x158393, 0x162a73, 0x172823, 0x18d077, 0x127d44,
-	0x1302b7, 0x141793, 0x150637, 0x160713, 0x172a23, 0x18d057,
-	0x127d50, 0x130613, 0x140256, 0x152c23, 0x16d0c7, 0x178493,
-	0x187474, 0x127d5c, 0x132e23, 0x14d097, 0x150413, 0x164a74,
-	0x172423, 0x18e087, 0x127d68, 0x131437, 0x14050a, 0x152623,
-	0x16e067, 0x170413, 0x188c74, 0x127d74, 0x132823, 0x14e087,
-	0x152023, 0x16ec77, 0x172223, 0x18ec57, 0x127d80, 0x1313b7,
-	0x1497ba, 0x152423, 0x16ecc7, 0x178413, 0x18a473, 0x127d8c,
-	0x132623, 0x14ec87, 0x158413, 0x167b75, 0x172223, 0x185287,
-	0x127d98, 0x138437, 0x140cc7, 0x150413, 0x167934, 0x172423,
-	0x185287, 0x127da4, 0x130437, 0x140e87, 0x152e23, 0x1676a7,
-	0x170413, 0x187134, 0x127db0, 0x132223, 0x147887, 0x1504b7,
-	0x160713, 0x176715, 0x182023, 0x127dbc, 0x13baa7, 0x148413,
-	0x1578a4, 0x162223, 0x17ba87, 0x188413, 0x127dc8, 0x131473,
-	0x142423, 0x15ba87, 0x160437, 0x1776b7, 0x180413, 0x127dd4,
-	0x130e64, 0x14c700, 0x150437, 0x16070a, 0x17c740, 0x188437,
-	0x127de0, 0x131306, 0x140413, 0x156934, 0x16cb00, 0x172a23,
-	0x1858a7, 0x127dec, 0x138413, 0x1478a4, 0x152c23, 0x165887,
-	0x178393, 0x185c73, 0x127df8, 0x132e23, 0x145877, 0x15a3b7,
-	0x167737, 0x178413, 0x186f73, 0x127e04, 0x132823, 0x145a87,
-	0x150437, 0x16078a, 0x172a23, 0x185a87, 0x127e10, 0x130437,
-	0x141707, 0x150413, 0x167134, 0x172c23, 0x185a87, 0x127e1c,
-	0x138393, 0x144f73, 0x152823, 0x165c77, 0x170437, 0x18078a,
-	0x127e28, 0x1303b7, 0x141847, 0x152a23, 0x165c87, 0x178393,
-	0x187133, 0x127e34, 0x132c23, 0x145c77, 0x1593b7, 0x167737,
-	0x178393, 0x186a73, 0x127e40, 0x132a23, 0x146a77, 0x152c23,
-	0x166a57, 0x1723b7, 0x1897ba, 0x127e4c, 0x132e23, 0x146ac7,
-	0x158413, 0x16a073, 0x172023, 0x186c87, 0x127e58, 0x131437,
-	0x1477b7, 0x156719, 0x160413, 0x174d74, 0x182623, 0x127e64,
-	0x138e87, 0x142437, 0x15068a, 0x162823, 0x178e67, 0x180413,
-	0x127e70, 0x13c874, 0x142a23, 0x158e87, 0x16c437, 0x177737,
-	0x180413, 0x127e7c, 0x136a74, 0x142c23, 0x15ba87, 0x162e23,
-	0x17ba57, 0x182023, 0x127e88, 0x13bcc7, 0x148613, 0x15dc73,
-	0x162223, 0x17bcc7, 0x18d348, 0x127e94, 0x138613, 0x1478a4,
-	0x15d710, 0x168393, 0x17f873, 0x182623, 0x127ea0, 0x130277,
-	0x14e737, 0x1577b7, 0x160713, 0x178e77, 0x18a423, 0x127eac,
-	0x13cce5, 0x142737, 0x15070a, 0x16a623, 0x17cc65, 0x180713,
-	0x127eb8, 0x130c77, 0x14a823, 0x15cce5, 0x16f737, 0x174510,
-	0x180713, 0x127ec4, 0x138e77, 0x14ac23, 0x1520e7, 0x164737,
-	0x173191, 0x180713, 0x127ed0, 0x135017, 0x14a223, 0x1524e7,
-	0x160737, 0x170200, 0x180713, 0x127edc, 0x137137, 0x14ae23,
-	0x15f6e7, 0x165737, 0x170713, 0x181761, 0x127ee8, 0x13a223,
-	0x14f8e7, 0x150737, 0x16cff8, 0x170713, 0x184007, 0x127ef4,
-	0x13a423, 0x14f8e7, 0x150737, 0x163fb0, 0x170713, 0x187137,
-	0x127f00, 0x13a623, 0x14f8e7, 0x151737, 0x160793, 0x170713,
-	0x188007, 0x127f0c, 0x13a823, 0x14f4e7, 0x151737, 0x16c37c,
-	0x17aa23, 0x18f4e7, 0x127f18, 0x136737, 0x14e793, 0x150713,
-	0x167a17, 0x17ac23, 0x18f4e7, 0x127f24, 0x131737, 0x14cb3c,
-	0x150713, 0x168077, 0x17ae23, 0x18f4e7, 0x127f30, 0x130737,
-	0x146080, 0x150713, 0x167937, 0x17a023, 0x18f6e7, 0x127f3c,
-	0x13d737, 0x148082, 0x150713, 0x16b7c7, 0x17a223, 0x18f6e7,
-	0x127f48, 0x136737, 0x140793, 0x150613, 0x164447, 0x17aa23,
-	0x184cc6, 0x127f54, 0x130637, 0x14a223, 0x150613, 0x162006,
-	0x17ac23, 0x184cc6, 0x127f60, 0x130713, 0x144f47, 0x15ae23,
-	0x164ce6, 0x174737, 0x18d0fc, 0x127f6c, 0x130713, 0x14fa07,
-	0x15a023, 0x164ee6, 0x178737, 0x189207, 0x127f78, 0x130713,
-	0x147937, 0x15a223, 0x16f2e7, 0x17c737, 0x1867a1, 0x127f84,
-	0x130713, 0x1437c7, 0x15a423, 0x16f2e7, 0x178737, 0x187807,
-	0x127f90, 0x130713, 0x147937, 0x15a623, 0x16f2e7, 0x17d737,
-	0x180793, 0x127f9c, 0x130713, 0x14b3c7, 0x15a823, 0x16f2e7,
-	0x176737, 0x18cb7c, 0x127fa8, 0x130713, 0x140807, 0x15aa23,
-	0x16f2e7, 0x178737, 0x188082, 0x127fb4, 0x130713, 0x140827,
-	0x15ac23, 0x16f2e7, 0x17806f, 0x18af4f, 0x127fc0, 0x134412,
-	0x144482, 0x154501, 0x160121, 0x178082, 0x184398, 0x127fcc,
-	0x13b94d, 0x140000, 0x150000, 0x160000, 0x170000, 0x180000,
-	0x110000, 0x127c30, 0x104000, 0x1f0000,
+static const u16 init_data3[] = {
+	0x1f01, 0x00a0, 0x1901, 0x03f3, 0x1f01, 0x0012, 0x1501, 0x0100,
+	0x1f01, 0x00ad, 0x1002, 0x0000, 0xe0c6, 0x1f01, 0x00a0, 0x1901,
+	0x03fb, 0x1901, 0x03fb, 0x1901, 0x03fb, 0x1901, 0x03fb, 0x1901,
+	0x03fb, 0x1901, 0x03fb, 0x1f01, 0x0012, 0x1501, 0x0000, 0x1f01,
+	0x00ad, 0x1108, 0x0000, 0x7c30, 0x8137, 0x0000, 0x006f, 0x00e0,
+	0x0000, 0x0000, 0x1207, 0x7c3c, 0x0000, 0x0000, 0x0000, 0x1161,
+	0x7601, 0x95b7, 0x1207, 0x7c48, 0xfffd, 0x6541, 0x86b7, 0x0002,
+	0xc222, 0xc026, 0x1207, 0x7c54, 0x07b7, 0x0002, 0x0613, 0x2b06,
+	0x8593, 0x3085, 0x1207, 0x7c60, 0x0293, 0x2900, 0x157d, 0x8693,
+	0x97c6, 0x8733, 0x1207, 0x7c6c, 0x00b7, 0x8333, 0x00c7, 0xec63,
+	0x34e2, 0x4398, 0x1207, 0x7c78, 0x8f69, 0x0713, 0x2b07, 0x2023,
+	0x00e3, 0x0791, 0x1207, 0x7c84, 0x93e3, 0xfed7, 0x67a1, 0x659d,
+	0x8793, 0x1377, 0x1207, 0x7c90, 0x2423, 0x2ef0, 0x8713, 0x6b75,
+	0x6785, 0xac23, 0x1207, 0x7c9c, 0xeae7, 0x0737, 0x8693, 0x0713,
+	0x70a7, 0xae23, 0x1207, 0x7ca8, 0xeae7, 0x0737, 0x9737, 0x0713,
+	0xa867, 0xa023, 0x1207, 0x7cb4, 0xece7, 0x1737, 0x7737, 0x6789,
+	0x0713, 0x8f77, 0x1207, 0x7cc0, 0xae23, 0x0ce7, 0x0737, 0x078a,
+	0xa023, 0x0ee7, 0x1207, 0x7ccc, 0x0737, 0xffc7, 0x0713, 0x7137,
+	0xa223, 0x0ee7, 0x1207, 0x7cd8, 0x3737, 0x7337, 0x0713, 0x2a37,
+	0xae23, 0x3ce7, 0x1207, 0x7ce4, 0x02b7, 0x050a, 0x0737, 0x0103,
+	0xa023, 0x3e57, 0x1207, 0x7cf0, 0x0713, 0x3137, 0xa223, 0x3ee7,
+	0x668d, 0x8513, 0x1207, 0x7cfc, 0x7375, 0x04b7, 0x0713, 0xae23,
+	0xa0a6, 0x8313, 0x1207, 0x7d08, 0x78a4, 0x04b7, 0x97ba, 0xa023,
+	0xa266, 0x8713, 0x1207, 0x7d14, 0x2474, 0x0437, 0x77b7, 0xa223,
+	0xa2e6, 0x0313, 0x1207, 0x7d20, 0x0a74, 0x6711, 0x2c23, 0xc667,
+	0x0337, 0x8793, 0x1207, 0x7d2c, 0x2e23, 0xc667, 0x8293, 0x6072,
+	0x03b7, 0x7737, 0x1207, 0x7d38, 0x2023, 0xc857, 0x8393, 0x2a73,
+	0x2823, 0xd077, 0x1207, 0x7d44, 0x02b7, 0x1793, 0x0637, 0x0713,
+	0x2a23, 0xd057, 0x1207, 0x7d50, 0x0613, 0x0256, 0x2c23, 0xd0c7,
+	0x8493, 0x7474, 0x1207, 0x7d5c, 0x2e23, 0xd097, 0x0413, 0x4a74,
+	0x2423, 0xe087, 0x1207, 0x7d68, 0x1437, 0x050a, 0x2623, 0xe067,
+	0x0413, 0x8c74, 0x1207, 0x7d74, 0x2823, 0xe087, 0x2023, 0xec77,
+	0x2223, 0xec57, 0x1207, 0x7d80, 0x13b7, 0x97ba, 0x2423, 0xecc7,
+	0x8413, 0xa473, 0x1207, 0x7d8c, 0x2623, 0xec87, 0x8413, 0x7b75,
+	0x2223, 0x5287, 0x1207, 0x7d98, 0x8437, 0x0cc7, 0x0413, 0x7934,
+	0x2423, 0x5287, 0x1207, 0x7da4, 0x0437, 0x0e87, 0x2e23, 0x76a7,
+	0x0413, 0x7134, 0x1207, 0x7db0, 0x2223, 0x7887, 0x04b7, 0x0713,
+	0x6715, 0x2023, 0x1207, 0x7dbc, 0xbaa7, 0x8413, 0x78a4, 0x2223,
+	0xba87, 0x8413, 0x1207, 0x7dc8, 0x1473, 0x2423, 0xba87, 0x0437,
+	0x76b7, 0x0413, 0x1207, 0x7dd4, 0x0e64, 0xc700, 0x0437, 0x070a,
+	0xc740, 0x8437, 0x1207, 0x7de0, 0x1306, 0x0413, 0x6934, 0xcb00,
+	0x2a23, 0x58a7, 0x1207, 0x7dec, 0x8413, 0x78a4, 0x2c23, 0x5887,
+	0x8393, 0x5c73, 0x1207, 0x7df8, 0x2e23, 0x5877, 0xa3b7, 0x7737,
+	0x8413, 0x6f73, 0x1207, 0x7e04, 0x2823, 0x5a87, 0x0437, 0x078a,
+	0x2a23, 0x5a87, 0x1207, 0x7e10, 0x0437, 0x1707, 0x0413, 0x7134,
+	0x2c23, 0x5a87, 0x1207, 0x7e1c, 0x8393, 0x4f73, 0x2823, 0x5c77,
+	0x0437, 0x078a, 0x1207, 0x7e28, 0x03b7, 0x1847, 0x2a23, 0x5c87,
+	0x8393, 0x7133, 0x1207, 0x7e34, 0x2c23, 0x5c77, 0x93b7, 0x7737,
+	0x8393, 0x6a73, 0x1207, 0x7e40, 0x2a23, 0x6a77, 0x2c23, 0x6a57,
+	0x23b7, 0x97ba, 0x1207, 0x7e4c, 0x2e23, 0x6ac7, 0x8413, 0xa073,
+	0x2023, 0x6c87, 0x1207, 0x7e58, 0x1437, 0x77b7, 0x6719, 0x0413,
+	0x4d74, 0x2623, 0x1207, 0x7e64, 0x8e87, 0x2437, 0x068a, 0x2823,
+	0x8e67, 0x0413, 0x1207, 0x7e70, 0xc874, 0x2a23, 0x8e87, 0xc437,
+	0x7737, 0x0413, 0x1207, 0x7e7c, 0x6a74, 0x2c23, 0xba87, 0x2e23,
+	0xba57, 0x2023, 0x1207, 0x7e88, 0xbcc7, 0x8613, 0xdc73, 0x2223,
+	0xbcc7, 0xd348, 0x1207, 0x7e94, 0x8613, 0x78a4, 0xd710, 0x8393,
+	0xf873, 0x2623, 0x1207, 0x7ea0, 0x0277, 0xe737, 0x77b7, 0x0713,
+	0x8e77, 0xa423, 0x1207, 0x7eac, 0xcce5, 0x2737, 0x070a, 0xa623,
+	0xcc65, 0x0713, 0x1207, 0x7eb8, 0x0c77, 0xa823, 0xcce5, 0xf737,
+	0x4510, 0x0713, 0x1207, 0x7ec4, 0x8e77, 0xac23, 0x20e7, 0x4737,
+	0x3191, 0x0713, 0x1207, 0x7ed0, 0x5017, 0xa223, 0x24e7, 0x0737,
+	0x0200, 0x0713, 0x1207, 0x7edc, 0x7137, 0xae23, 0xf6e7, 0x5737,
+	0x0713, 0x1761, 0x1207, 0x7ee8, 0xa223, 0xf8e7, 0x0737, 0xcff8,
+	0x0713, 0x4007, 0x1207, 0x7ef4, 0xa423, 0xf8e7, 0x0737, 0x3fb0,
+	0x0713, 0x7137, 0x1207, 0x7f00, 0xa623, 0xf8e7, 0x1737, 0x0793,
+	0x0713, 0x8007, 0x1207, 0x7f0c, 0xa823, 0xf4e7, 0x1737, 0xc37c,
+	0xaa23, 0xf4e7, 0x1207, 0x7f18, 0x6737, 0xe793, 0x0713, 0x7a17,
+	0xac23, 0xf4e7, 0x1207, 0x7f24, 0x1737, 0xcb3c, 0x0713, 0x8077,
+	0xae23, 0xf4e7, 0x1207, 0x7f30, 0x0737, 0x6080, 0x0713, 0x7937,
+	0xa023, 0xf6e7, 0x1207, 0x7f3c, 0xd737, 0x8082, 0x0713, 0xb7c7,
+	0xa223, 0xf6e7, 0x1207, 0x7f48, 0x6737, 0x0793, 0x0613, 0x4447,
+	0xaa23, 0x4cc6, 0x1207, 0x7f54, 0x0637, 0xa223, 0x0613, 0x2006,
+	0xac23, 0x4cc6, 0x1207, 0x7f60, 0x0713, 0x4f47, 0xae23, 0x4ce6,
+	0x4737, 0xd0fc, 0x1207, 0x7f6c, 0x0713, 0xfa07, 0xa023, 0x4ee6,
+	0x8737, 0x9207, 0x1207, 0x7f78, 0x0713, 0x7937, 0xa223, 0xf2e7,
+	0xc737, 0x67a1, 0x1207, 0x7f84, 0x0713, 0x37c7, 0xa423, 0xf2e7,
+	0x8737, 0x7807, 0x1207, 0x7f90, 0x0713, 0x7937, 0xa623, 0xf2e7,
+	0xd737, 0x0793, 0x1207, 0x7f9c, 0x0713, 0xb3c7, 0xa823, 0xf2e7,
+	0x6737, 0xcb7c, 0x1207, 0x7fa8, 0x0713, 0x0807, 0xaa23, 0xf2e7,
+	0x8737, 0x8082, 0x1207, 0x7fb4, 0x0713, 0x0827, 0xac23, 0xf2e7,
+	0x806f, 0xaf4f, 0x1207, 0x7fc0, 0x4412, 0x4482, 0x4501, 0x0121,
+	0x8082, 0x4398, 0x1207, 0x7fcc, 0xb94d, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x1102, 0x0000, 0x7c30, 0x1001, 0x4000, 0x1f01,
+	0x0000,
 };
+#endif
 
+/* The firmware version has already been matched through the index */
 static bool jl2xxx_patch_check(struct phy_device *phydev,
-			      struct jl_patch *patch)
+			       struct jl_patch *patch, int mode)
 {
-
-	bool patch_ok = false;
-	int val;
-	int i;
-
-	val = jlsemi_read_paged(phydev, JL2XXX_PAGE0, JL2XXX_PHY_INFO_REG);
-	for (i = 0; i < patch->phy.info_len; i++) {
-		if (val == patch->phy.info[i])
-			patch_ok |= true;
-	}
-
-	return patch_ok;
+	return true;
 }
 
 static bool jl2xxx_patch_zte_check(struct phy_device *phydev,
-				   struct jl_patch *patch)
+				   struct jl_patch *patch, int mode)
 {
 	struct jl2xxx_priv *priv = phydev->priv;
-	bool patch_ok = false;
-	int mode;
 
-	mode = jlsemi_read_paged(phydev, JL2XXX_PAGE18, JL2XXX_WORK_MODE_REG);
 	/* Can only be used in sgmii->utp mode */
-	if (((priv->work_mode.enable & JL2XXX_WORK_MODE_STATIC_OP_EN) &&
-	   (priv->work_mode.mode == JL2XXX_UTP_SGMII_MODE)) ||
-	   ((mode & JL2XXX_WORK_MODE_MASK) == JL2XXX_UTP_SGMII_MODE)) {
-		patch_ok = jl2xxx_patch_check(phydev, patch);
+	return ((priv->work_mode.enable & JL2XXX_WORK_MODE_STATIC_OP_EN) &&
+		(priv->work_mode.mode == JL2XXX_UTP_SGMII_MODE)) ||
+	       ((mode & JL2XXX_WORK_MODE_MASK) == JL2XXX_UTP_SGMII_MODE);
+}
+
+/**
+ * jl2xxx_patch_stream_valid() - check that all runs fit in the stream
+ * @data: patch stream
+ * @len: number of words
+ */
+static bool jl2xxx_patch_stream_valid(const u16 *data, int len)
+{
+	int count;
+	int i;
+
+	for (i = 0; i < len; i += count + 1) {
+		count = JL2XXX_PATCH_RUN_LEN(data[i]);
+		if (!count || i + count >= len)
+			return false;
 	}
-	return patch_ok;
+
+	return true;
 }
 
+/* One patch group per mdio bus, the list is guarded by jl2xxx_patch_lock
+ * and each group by its own lock, so buses download in parallel
+ */
+static LIST_HEAD(jl2xxx_patch_buses);
+static DEFINE_MUTEX(jl2xxx_patch_lock);
+
+static int jl2xxx_patch_group_get(struct phy_device *phydev,
+				  struct jl_patch *patch,
+				  struct jl_patch_target *targets);
+
+/* Downloads @patch to @phydev and to the identical phys on its bus, the
+ * peers are verified here while @phydev is left to jl2xxx_pre_init()
+ */
 static int jl2xxx_patch_load(struct phy_device *phydev,
 			     struct jl_patch *patch)
 {
-	int regaddr, val;
-	int i, j;
-
-	for (i = 0; i < patch->data_len; i++) {
-		regaddr = ((patch->data[i] >> 16) & 0xff);
-		val = (patch->data[i] & 0xffff);
-		phy_write(phydev, regaddr, val);
-		if (regaddr == 0x18) {
-			phy_write(phydev, 0x10, 0x8006);
-			for (j = 0; j < 8; j++) {
-				if (phy_read(phydev, 0x10) == 0)
-					break;
-			}
+	struct jl_patch_target *targets;
+	struct jl2xxx_priv *priv;
+	unsigned long start = jiffies;
+	unsigned int ms;
+	int count, words;
+	int err, i;
+
+	targets = kcalloc(PHY_MAX_ADDR, sizeof(*targets), GFP_KERNEL);
+	if (!targets)
+		return -ENOMEM;
+
+	count = jl2xxx_patch_group_get(phydev, patch, targets);
+	trace_jlsemi_patch_load_start(jlsemi_trace_dev(phydev), count,
+				      patch->data_len);
+
+	words = jlsemi_download_patch(targets, count, patch->data,
+				      patch->data_len);
+	if (words < 0) {
+		JLSEMI_PHY_MSG(KERN_ERR "%s: patch download failed %d\n",
+			       __func__, words);
+		trace_jlsemi_patch_load_end(jlsemi_trace_dev(phydev), words,
+					    jiffies_to_msecs(jiffies - start));
+		kfree(targets);
+		return words;
+	}
+	/* Wait load patch complete, once for the whole group */
+	msleep(JL2XXX_PATCH_SETTLE_MS);
+	ms = jiffies_to_msecs(jiffies - start);
+	trace_jlsemi_patch_load_end(jlsemi_trace_dev(phydev), words, ms);
+
+	for (i = 0; i < count; i++) {
+		priv = targets[i].phydev->priv;
+		if (targets[i].err < 0) {
+			JLSEMI_PHY_MSG(KERN_ERR "%s: patch download failed %d\n",
+				       __func__, targets[i].err);
+			continue;
 		}
+		priv->patch.load_words = words;
+		priv->patch.load_ms = ms;
+		if (i == 0)
+			continue;
+		targets[i].patch->verify(targets[i].phydev, targets[i].patch);
+		priv->patch.loaded = targets[i].patch;
 	}
-	/* Wait load patch complete */
-	msleep(20);
+	JLSEMI_PHY_MSG("%s: %d words to %d phys in %u ms\n", __func__,
+		       words, count, ms);
 
-	return 0;
+	err = targets[0].err;
+	kfree(targets);
+
+	return err;
 }
 
 static int jl2xxx_patch_verify_by_version(struct phy_device *phydev,
@@ -2214,6 +2337,8 @@ static int jl2xxx_patch_verify_by_version(struct phy_device *phydev,
 	int version;
 
 	version = jlsemi_read_paged(phydev, JL2XXX_PAGE174, JL2XXX_PATCH_REG);
+	trace_jlsemi_patch_verify(jlsemi_trace_dev(phydev), patch->version,
+				  version);
 	if (version != patch->version)
 		JLSEMI_PHY_MSG(KERN_ERR
 			       "%s: patch version is not match\n", __func__);
@@ -2226,11 +2351,47 @@ static int jl2xxx_patch_verify_by_regval(struct phy_device *phydev,
 	int val;
 
 	val = jlsemi_read_paged(phydev, JL2XXX_PAGE179, JL2XXX_REG16);
+	trace_jlsemi_patch_verify(jlsemi_trace_dev(phydev), patch->version,
+				  val);
 	if (val != patch->version)
 		JLSEMI_PHY_MSG(KERN_ERR "%s: patch load failed!\n", __func__);
 	return 0;
 }
 
+/* The version register is cleared by a power cycle, a match means the
+ * patch is still running
+ */
+static bool jl2xxx_patch_active_by_version(struct phy_device *phydev,
+					   struct jl_patch *patch)
+{
+	int version;
+
+	if (!patch->version)
+		return false;
+
+	version = jlsemi_read_paged(phydev, JL2XXX_PAGE174, JL2XXX_PATCH_REG);
+
+	return version == patch->version;
+}
+
+/* The regval may match on unpatched silicon too, so also require that
+ * this patch was downloaded since the phy last lost power
+ */
+static bool jl2xxx_patch_active_by_regval(struct phy_device *phydev,
+					  struct jl_patch *patch)
+{
+	struct jl2xxx_priv *priv = phydev->priv;
+	int val;
+
+	if (priv->patch.loaded != patch)
+		return false;
+
+	val = jlsemi_read_paged(phydev, JL2XXX_PAGE179, JL2XXX_REG16);
+
+	return val == patch->version;
+}
+
+#if (JL2XXX_PATCH_BUILTIN)
 static struct jl_patch phy_patches[] = {
 	{
 		.data = init_data0,
@@ -2243,7 +2404,7 @@ static struct jl_patch phy_patches[] = {
 		.check = jl2xxx_patch_check,
 		.load = jl2xxx_patch_load,
 		.verify = jl2xxx_patch_verify_by_version,
-
+		.active = jl2xxx_patch_active_by_version,
 	},
 	{
 		.data = init_data1,
@@ -2256,6 +2417,7 @@ static struct jl_patch phy_patches[] = {
 		.check = jl2xxx_patch_check,
 		.load = jl2xxx_patch_load,
 		.verify = jl2xxx_patch_verify_by_version,
+		.active = jl2xxx_patch_active_by_version,
 	},
 	{
 		.data = init_data2,
@@ -2268,6 +2430,7 @@ static struct jl_patch phy_patches[] = {
 		.check = jl2xxx_patch_check,
 		.load = jl2xxx_patch_load,
 		.verify = jl2xxx_patch_verify_by_version,
+		.active = jl2xxx_patch_active_by_version,
 	},
 	{
 		.data = init_data3,
@@ -2280,573 +2443,3204 @@ static struct jl_patch phy_patches[] = {
 		.check = jl2xxx_patch_zte_check,
 		.load = jl2xxx_patch_load,
 		.verify = jl2xxx_patch_verify_by_regval,
+		.active = jl2xxx_patch_active_by_regval,
 	},
 };
+#endif
 
-int jl2xxx_patch_static_op_set(struct phy_device *phydev)
+static const struct jl_patch_fw_entry *
+jl2xxx_patch_fw_entry(const struct firmware *fw, size_t *offset)
 {
-	int found;
-	int i;
+	const struct jl_patch_fw_entry *entry;
+	size_t len;
 
-	for (i = 0; i < ARRAY_SIZE(phy_patches); i++) {
-		found = jl2xxx_pre_init(phydev, &phy_patches[i]);
-		if (found)
-			return found;
-	}
+	if (fw->size - *offset < sizeof(*entry))
+		return NULL;
 
-	return 0;
-}
+	entry = (const struct jl_patch_fw_entry *)(fw->data + *offset);
+	if (le16_to_cpu(entry->info_len) > JL2XXX_PATCH_FW_INFO_MAX ||
+	    le32_to_cpu(entry->data_len) > U16_MAX)
+		return NULL;
 
-int jl1xxx_wol_dynamic_op_get(struct phy_device *phydev)
-{
-	return jlsemi_fetch_bit(phydev, JL1XXX_PAGE129,
-				JL1XXX_WOL_CTRL_REG, JL1XXX_WOL_DIS);
-}
+	len = sizeof(*entry) + le32_to_cpu(entry->data_len) * sizeof(u16);
+	if (fw->size - *offset < len)
+		return NULL;
 
-int jl2xxx_wol_dynamic_op_get(struct phy_device *phydev)
-{
-	return jlsemi_fetch_bit(phydev, JL2XXX_WOL_CTRL_PAGE,
-				JL2XXX_WOL_CTRL_REG, JL2XXX_WOL_EN);
+	*offset += len;
+
+	return entry;
 }
 
-static int jl1xxx_wol_static_op_set(struct phy_device *phydev)
+static int jl2xxx_patch_fw_parse(struct phy_device *phydev,
+				 const struct firmware *fw)
 {
-	int err;
+	const struct jl_patch_fw_header *hdr;
+	const struct jl_patch_fw_entry *entry;
+	struct jl2xxx_priv *priv = phydev->priv;
+	struct jl_patch *patches;
+	size_t offset, words = 0;
+	u16 *info, *data;
+	int count, i, j;
 
-	err = jl1xxx_wol_dynamic_op_set(phydev);
-	if (err < 0)
-		return err;
+	if (fw->size < sizeof(*hdr))
+		return -EINVAL;
+
+	hdr = (const struct jl_patch_fw_header *)fw->data;
+	if (le32_to_cpu(hdr->magic) != JL2XXX_PATCH_FW_MAGIC ||
+	    le16_to_cpu(hdr->format) != JL2XXX_PATCH_FW_FORMAT)
+		return -EINVAL;
+
+	/* Validate every entry before allocating anything */
+	count = le16_to_cpu(hdr->count);
+	offset = sizeof(*hdr);
+	for (i = 0; i < count; i++) {
+		entry = jl2xxx_patch_fw_entry(fw, &offset);
+		if (!entry)
+			return -EINVAL;
+		words += le32_to_cpu(entry->data_len);
+	}
+
+	/* One block: patches, then fw versions, then patch streams */
+	patches = kzalloc(count * sizeof(*patches) +
+			  (count * JL2XXX_PATCH_FW_INFO_MAX + words) *
+			  sizeof(u16), GFP_KERNEL);
+	if (!patches)
+		return -ENOMEM;
+
+	info = (u16 *)(patches + count);
+	data = info + count * JL2XXX_PATCH_FW_INFO_MAX;
+	offset = sizeof(*hdr);
+	for (i = 0; i < count; i++) {
+		entry = jl2xxx_patch_fw_entry(fw, &offset);
+
+		patches[i].version = le16_to_cpu(entry->version);
+		patches[i].phy.info = info;
+		patches[i].phy.info_len = le16_to_cpu(entry->info_len);
+		for (j = 0; j < patches[i].phy.info_len; j++)
+			*info++ = le16_to_cpu(entry->info[j]);
+
+		patches[i].data = data;
+		patches[i].data_len = le32_to_cpu(entry->data_len);
+		for (j = 0; j < patches[i].data_len; j++)
+			*data++ = le16_to_cpu(entry->data[j]);
+
+		if (!jl2xxx_patch_stream_valid(patches[i].data,
+					       patches[i].data_len)) {
+			kfree(patches);
+			return -EINVAL;
+		}
+
+		patches[i].load = jl2xxx_patch_load;
+		if (le16_to_cpu(entry->check) == JL2XXX_PATCH_CHECK_ZTE) {
+			patches[i].check = jl2xxx_patch_zte_check;
+			patches[i].verify = jl2xxx_patch_verify_by_regval;
+			patches[i].active = jl2xxx_patch_active_by_regval;
+		} else {
+			patches[i].check = jl2xxx_patch_check;
+			patches[i].verify = jl2xxx_patch_verify_by_version;
+			patches[i].active = jl2xxx_patch_active_by_version;
+		}
+	}
+
+	priv->patch.fw_patches = patches;
+	priv->patch.fw_count = count;
 
 	return 0;
 }
 
-int jl1xxx_intr_ack_event(struct phy_device *phydev)
+static void jl2xxx_patch_fw_loaded(const struct firmware *fw, void *context)
 {
-	struct jl1xxx_priv *priv = phydev->priv;
+	struct phy_device *phydev = context;
+	struct jl2xxx_priv *priv = phydev->priv;
 	int err;
 
-	if (priv->intr.enable & JL1XXX_INTR_STATIC_OP_EN) {
-		err = phy_read(phydev, JL1XXX_INTR_STATUS_REG);
+	if (fw) {
+		err = jl2xxx_patch_fw_parse(phydev, fw);
 		if (err < 0)
-			return err;
+			JLSEMI_PHY_MSG(KERN_ERR "%s: bad patch firmware %d\n",
+				       __func__, err);
+		release_firmware(fw);
 	}
 
-	return 0;
+	complete_all(&priv->patch.fw_done);
 }
 
-int jl1xxx_intr_static_op_set(struct phy_device *phydev)
+/* Called with jl2xxx_patch_lock held */
+static struct jl_patch_bus *jl2xxx_patch_bus_get(struct phy_device *phydev)
 {
-	struct jl1xxx_priv *priv = phydev->priv;
-	int err;
-	int ret = 0;
+	struct mii_bus *bus = jlsemi_phy_bus(phydev);
+	struct jl_patch_bus *pbus;
 
-	if (priv->intr.enable & JL1XXX_INTR_LINK_CHANGE_EN)
-		ret |= JL1XXX_INTR_LINK;
-	if (priv->intr.enable & JL1XXX_INTR_AN_ERR_EN)
-		ret |= JL1XXX_INTR_AN_ERR;
+	list_for_each_entry(pbus, &jl2xxx_patch_buses, node) {
+		if (pbus->bus == bus)
+			return pbus;
+	}
 
-	err = jlsemi_set_bits(phydev, JL1XXX_PAGE7,
-			      JL1XXX_INTR_REG, ret);
-	if (err < 0)
-		return err;
+	pbus = kzalloc(sizeof(*pbus), GFP_KERNEL);
+	if (!pbus)
+		return NULL;
 
-	return 0;
+	pbus->bus = bus;
+	INIT_LIST_HEAD(&pbus->phys);
+	mutex_init(&pbus->lock);
+	list_add_tail(&pbus->node, &jl2xxx_patch_buses);
+
+	return pbus;
 }
 
-static int jl2xxx_wol_static_op_set(struct phy_device *phydev)
+static int jl2xxx_patch_bus_join(struct phy_device *phydev)
 {
-	int err;
-
-	err = jl2xxx_wol_dynamic_op_set(phydev);
-	if (err < 0)
-		return err;
+	struct jl2xxx_priv *priv = phydev->priv;
+	struct jl_patch_bus *pbus;
+
+	mutex_lock(&jl2xxx_patch_lock);
+	pbus = jl2xxx_patch_bus_get(phydev);
+	if (pbus) {
+		mutex_lock(&pbus->lock);
+		list_add_tail(&priv->patch.node, &pbus->phys);
+		mutex_unlock(&pbus->lock);
+		priv->patch.bus = pbus;
+	}
+	mutex_unlock(&jl2xxx_patch_lock);
 
-	return 0;
+	return pbus ? 0 : -ENOMEM;
 }
 
-int jl1xxx_wol_dynamic_op_set(struct phy_device *phydev)
+/**
+ * jl2xxx_patch_fw_request() - start loading the patch firmware file
+ * @phydev: a pointer to a &struct phy_device
+ *
+ * The file is parsed in the background, jl2xxx_patch_static_op_set()
+ * waits for it for a bounded time and falls back to the built-in patches
+ * if it is missing or late.
+ */
+int jl2xxx_patch_fw_request(struct phy_device *phydev)
 {
+	struct jl2xxx_priv *priv = phydev->priv;
 	int err;
 
-	err = jl1xxx_wol_cfg_rmii(phydev);
-	if (err < 0)
-		return err;
-
-	err = jl1xxx_wol_enable(phydev, true);
-	if (err < 0)
-		return err;
+	init_completion(&priv->patch.fw_done);
 
-	err = jl1xxx_wol_store_mac_addr(phydev);
+	priv->patch.phydev = phydev;
+	err = jl2xxx_patch_bus_join(phydev);
 	if (err < 0)
 		return err;
 
-	if (jl1xxx_wol_receive_check(phydev)) {
-		err = jl1xxx_wol_clear(phydev);
-		if (err < 0)
-			return err;
+	if (!JL2XXX_PATCH_FIRMWARE ||
+	    !(priv->patch.enable & JL2XXX_PATCH_STATIC_OP_EN)) {
+		complete_all(&priv->patch.fw_done);
+		return 0;
 	}
 
+	err = request_firmware_nowait(THIS_MODULE, true, JL2XXX_PATCH_FW_NAME,
+				      jlsemi_get_mdio(phydev), GFP_KERNEL,
+				      phydev, jl2xxx_patch_fw_loaded);
+	if (err < 0)
+		complete_all(&priv->patch.fw_done);
+
 	return 0;
 }
 
-int jl2xxx_wol_dynamic_op_set(struct phy_device *phydev)
+/**
+ * jl2xxx_patch_fw_release() - free the patches parsed from firmware
+ * @phydev: a pointer to a &struct phy_device
+ */
+void jl2xxx_patch_release(struct phy_device *phydev)
 {
-	int err;
-
-	err = jl2xxx_wol_enable(phydev, true);
-	if (err < 0)
-		return err;
+	struct jl2xxx_priv *priv = phydev->priv;
+	struct jl_patch_bus *pbus = priv->patch.bus;
+	bool last;
+
+	/* The request callback still refers to priv */
+	wait_for_completion(&priv->patch.fw_done);
+
+	/* And so may the patch group of another phy */
+	mutex_lock(&jl2xxx_patch_lock);
+	mutex_lock(&pbus->lock);
+	list_del(&priv->patch.node);
+	kfree(priv->patch.index);
+	priv->patch.index = NULL;
+	priv->patch.index_len = 0;
+	kfree(priv->patch.fw_patches);
+	priv->patch.fw_patches = NULL;
+	priv->patch.fw_count = 0;
+	last = list_empty(&pbus->phys);
+	mutex_unlock(&pbus->lock);
+	priv->patch.bus = NULL;
+	if (last)
+		list_del(&pbus->node);
+	mutex_unlock(&jl2xxx_patch_lock);
+
+	if (last)
+		kfree(pbus);
+}
 
-	err = jl2xxx_wol_clear(phydev);
-	if (err < 0)
-		return err;
+static int jl2xxx_patch_index_cmp(const void *a, const void *b)
+{
+	const struct jl_patch_index *x = a, *y = b;
 
-	err = jl2xxx_wol_active_low_polarity(phydev, true);
-	if (err < 0)
-		return err;
+	if (x->info != y->info)
+		return x->info < y->info ? -1 : 1;
 
-	err = jl2xxx_store_mac_addr(phydev);
-	if (err < 0)
-		return err;
+	/* Keep the table order between patches for the same version */
+	if (x->patch != y->patch)
+		return x->patch < y->patch ? -1 : 1;
 
 	return 0;
 }
 
-int jl2xxx_intr_ack_event(struct phy_device *phydev)
+static int jl2xxx_patch_info_cmp(const void *key, const void *elt)
 {
-	int err;
+	const struct jl_patch_index *x = elt;
+	u16 info = *(const u16 *)key;
 
-	err = jlsemi_read_paged(phydev, JL2XXX_PAGE2627,
-				JL2XXX_INTR_STATUS_REG);
-	if (err < 0)
-		return err;
+	if (info != x->info)
+		return info < x->info ? -1 : 1;
 
 	return 0;
 }
 
-int jl2xxx_intr_static_op_set(struct phy_device *phydev)
+/**
+ * jl2xxx_patch_index_build() - index patches by the fw versions they target
+ * @phydev: a pointer to a &struct phy_device
+ * @patches: patch table, firmware or built-in
+ * @count: number of patches
+ */
+static int jl2xxx_patch_index_build(struct phy_device *phydev,
+				    struct jl_patch *patches, int count)
 {
 	struct jl2xxx_priv *priv = phydev->priv;
-	int err;
-	int ret = 0;
+	struct jl_patch_index *index;
+	int len = 0;
+	int i, j;
 
-	if (priv->intr.enable & JL2XXX_INTR_LINK_CHANGE_EN)
-		ret |= JL2XXX_INTR_LINK_CHANGE;
-	if (priv->intr.enable & JL2XXX_INTR_AN_ERR_EN)
-		ret |= JL2XXX_INTR_AN_ERR;
-	if (priv->intr.enable & JL2XXX_INTR_AN_COMPLETE_EN)
-		ret |= JL2XXX_INTR_AN_COMPLETE;
-	if (priv->intr.enable & JL2XXX_INTR_AN_PAGE_RECE)
-		ret |= JL2XXX_INTR_AN_PAGE;
+	for (i = 0; i < count; i++)
+		len += patches[i].phy.info_len;
 
-	err = jlsemi_set_bits(phydev, JL2XXX_PAGE2626,
-			      JL2XXX_INTR_CTRL_REG, ret);
-	if (err < 0)
-		return err;
+	index = kcalloc(len ? len : 1, sizeof(*index), GFP_KERNEL);
+	if (!index)
+		return -ENOMEM;
 
-	err = jlsemi_set_bits(phydev, JL2XXX_PAGE158,
-			      JL2XXX_INTR_PIN_REG,
-			      JL2XXX_INTR_PIN_EN);
-	if (err < 0)
-		return err;
+	len = 0;
+	for (i = 0; i < count; i++) {
+		for (j = 0; j < patches[i].phy.info_len; j++) {
+			index[len].info = patches[i].phy.info[j];
+			index[len].patch = &patches[i];
+			len++;
+		}
+	}
+	sort(index, len, sizeof(*index), jl2xxx_patch_index_cmp, NULL);
 
-	err = jlsemi_set_bits(phydev, JL2XXX_PAGE160,
-			      JL2XXX_PIN_EN_REG,
-			      JL2XXX_PIN_OUTPUT);
-	if (err < 0)
-		return err;
+	priv->patch.index = index;
+	priv->patch.index_len = len;
 
 	return 0;
 }
 
-int jl1xxx_operation_args_get(struct phy_device *phydev)
+/**
+ * jl2xxx_patch_lookup() - find the first patch for a fw version
+ * @phydev: a pointer to a &struct phy_device
+ * @info: the PHY_INFO register value
+ *
+ * Return: the first index entry for @info, the following entries with
+ * the same version are the other candidates in table order
+ */
+static struct jl_patch_index *jl2xxx_patch_lookup(struct phy_device *phydev,
+						  u16 info)
 {
-	jl1xxx_led_operation_args(phydev);
-	jl1xxx_wol_operation_args(phydev);
-	jl1xxx_intr_operation_args(phydev);
-	jl1xxx_mdi_operation_args(phydev);
-	jl1xxx_rmii_operation_args(phydev);
+	struct jl2xxx_priv *priv = phydev->priv;
+	struct jl_patch_index *entry;
 
-	return 0;
+	entry = bsearch(&info, priv->patch.index, priv->patch.index_len,
+			sizeof(*entry), jl2xxx_patch_info_cmp);
+	if (!entry)
+		return NULL;
+
+	while (entry > priv->patch.index && (entry - 1)->info == info)
+		entry--;
+
+	return entry;
 }
 
-int jl2xxx_operation_args_get(struct phy_device *phydev)
+/**
+ * jl2xxx_patch_prepare() - wait for the firmware and index the patches
+ * @phydev: a pointer to a &struct phy_device
+ */
+static int jl2xxx_patch_prepare(struct phy_device *phydev)
 {
-	jl2xxx_led_operation_args(phydev);
-	jl2xxx_fld_operation_args(phydev);
-	jl2xxx_wol_operation_args(phydev);
-	jl2xxx_intr_operation_args(phydev);
-	jl2xxx_downshift_operation_args(phydev);
-	jl2xxx_rgmii_operation_args(phydev);
-	jl2xxx_patch_operation_args(phydev);
-	jl2xxx_clk_operation_args(phydev);
-	jl2xxx_work_mode_operation_args(phydev);
-	jl2xxx_lpbk_operation_args(phydev);
-	jl2xxx_slew_rate_operation_args(phydev);
-	jl2xxx_rxc_out_operation_args(phydev);
+	struct jl2xxx_priv *priv = phydev->priv;
+	struct jl_patch *patches = NULL;
+	unsigned long timeout;
+	bool fw_done;
+	int count = 0;
 
-	return 0;
+	if (priv->patch.index)
+		return 0;
+
+	/* With the usermode helper fallback a missing file only fails
+	 * after the loading timeout, don't hold config_init up for it
+	 */
+	timeout = msecs_to_jiffies(JL2XXX_PATCH_FW_WAIT_MS);
+	fw_done = wait_for_completion_timeout(&priv->patch.fw_done, timeout);
+	if (!fw_done)
+		JLSEMI_PHY_MSG(KERN_WARNING
+			       "%s: patch firmware not loaded in time\n",
+			       __func__);
+
+	if (fw_done && priv->patch.fw_count) {
+		patches = priv->patch.fw_patches;
+		count = priv->patch.fw_count;
+	}
+#if (JL2XXX_PATCH_BUILTIN)
+	else {
+		patches = phy_patches;
+		count = ARRAY_SIZE(phy_patches);
+	}
+#endif
+	return jl2xxx_patch_index_build(phydev, patches, count);
 }
 
-int jl1xxx_static_op_init(struct phy_device *phydev)
+/**
+ * jl2xxx_patch_find() - find the patch for the fw version of a phy
+ * @phydev: a pointer to a &struct phy_device
+ * @patch: set to the matching patch, NULL if there is none
+ * @mode: set to the work mode register value
+ *
+ * Called by the phy for itself with the lock of the bus patch group
+ * held. The result is kept for the peers to compare against.
+ */
+static int jl2xxx_patch_find(struct phy_device *phydev,
+			     struct jl_patch **patch, int *mode)
 {
-	struct jl1xxx_priv *priv = phydev->priv;
-	int err;
+	struct jl2xxx_priv *priv = phydev->priv;
+	struct jl_patch_index *entry, *end;
+	int info;
 
-	if (priv->led.enable & JL1XXX_LED_STATIC_OP_EN) {
-		err = jl1xxx_led_static_op_set(phydev);
-		if (err < 0)
-			return err;
-	}
+	*patch = NULL;
+	priv->patch.selected = NULL;
 
-	if (priv->wol.enable & JL1XXX_WOL_STATIC_OP_EN) {
-		err = jl1xxx_wol_static_op_set(phydev);
-		if (err < 0)
-			return err;
-	}
+	/* Two reads, however many patches there are */
+	info = jlsemi_read_paged(phydev, JL2XXX_PAGE0, JL2XXX_PHY_INFO_REG);
+	if (info < 0)
+		return info;
 
-	if (priv->intr.enable & JL1XXX_INTR_STATIC_OP_EN) {
-		err = jl1xxx_intr_static_op_set(phydev);
-		if (err < 0)
-			return err;
-	}
+	*mode = jl2xxx_work_mode_get(phydev);
+	if (*mode < 0)
+		return *mode;
 
-	if (priv->mdi.enable & JL1XXX_MDI_STATIC_OP_EN) {
-		err = jl1xxx_mdi_static_op_set(phydev);
-		if (err < 0)
-			return err;
-	}
+	entry = jl2xxx_patch_lookup(phydev, info);
+	if (!entry)
+		return 0;
 
-	if (priv->rmii.enable & JL1XXX_RMII_STATIC_OP_EN) {
-		err = jl1xxx_rmii_static_op_set(phydev);
-		if (err < 0)
-			return err;
+	end = priv->patch.index + priv->patch.index_len;
+	for (; entry < end && entry->info == info; entry++) {
+		if (entry->patch->check(phydev, entry->patch, *mode)) {
+			*patch = entry->patch;
+			break;
+		}
 	}
+	priv->patch.selected = *patch;
 
 	return 0;
 }
 
-int jl2xxx_static_op_init(struct phy_device *phydev)
+/* Patches from different tables are the same if they write the same words */
+static bool jl2xxx_patch_same(const struct jl_patch *a,
+			      const struct jl_patch *b)
 {
-	struct jl2xxx_priv *priv = phydev->priv;
-	int err;
+	if (a == b)
+		return true;
 
-	if (priv->patch.enable & JL2XXX_PATCH_STATIC_OP_EN) {
-		err = jl2xxx_patch_static_op_set(phydev);
-		if (err < 0)
-			return err;
-	}
+	return a->version == b->version && a->data_len == b->data_len &&
+	       a->verify == b->verify &&
+	       !memcmp(a->data, b->data, a->data_len * sizeof(*a->data));
+}
 
-	if (priv->led.enable & JL2XXX_LED_STATIC_OP_EN) {
-		err = jl2xxx_led_static_op_set(phydev);
-		if (err < 0)
-			return err;
-	}
+/**
+ * jl2xxx_patch_group_get() - collect the phys that take the same patch
+ * @phydev: the phy being initialized, always the first target
+ * @patch: the patch found for @phydev
+ * @targets: room for PHY_MAX_ADDR entries
+ *
+ * The peers are the other jl2xxx phys on the same mdio bus whose own
+ * patch_find selected the same patch and that have not had it downloaded
+ * since they last lost power. Only that recorded state is compared, the
+ * peers are not accessed. Called with the lock of the bus patch group
+ * held.
+ *
+ * Return: the number of targets
+ */
+static int jl2xxx_patch_group_get(struct phy_device *phydev,
+				  struct jl_patch *patch,
+				  struct jl_patch_target *targets)
+{
+	struct jl2xxx_priv *priv = phydev->priv;
+	struct jl_patch_bus *pbus = priv->patch.bus;
+	struct jl_patch *peer_patch;
+	int count = 0;
+
+	targets[count].phydev = phydev;
+	targets[count].patch = patch;
+	count++;
+
+	if (!JL2XXX_PATCH_GROUP)
+		return count;
+
+	list_for_each_entry(priv, &pbus->phys, patch.node) {
+		if (priv->patch.phydev == phydev)
+			continue;
+		if (!(priv->patch.enable & JL2XXX_PATCH_STATIC_OP_EN))
+			continue;
+		if (count >= PHY_MAX_ADDR)
+			break;
+
+		peer_patch = priv->patch.selected;
+		if (!peer_patch || !jl2xxx_patch_same(patch, peer_patch))
+			continue;
+		if (priv->patch.loaded == peer_patch)
+			continue;
+
+		targets[count].phydev = priv->patch.phydev;
+		targets[count].patch = peer_patch;
+		count++;
+	}
+
+	return count;
+}
+
+int jl2xxx_patch_static_op_set(struct phy_device *phydev)
+{
+	struct jl2xxx_priv *priv = phydev->priv;
+	struct jl_patch_bus *pbus = priv->patch.bus;
+	struct jl_patch *patch;
+	int mode;
+	int err;
+
+	mutex_lock(&pbus->lock);
+	err = jl2xxx_patch_prepare(phydev);
+	if (err < 0)
+		goto unlock;
+
+	err = jl2xxx_patch_find(phydev, &patch, &mode);
+	if (err < 0 || !patch)
+		goto unlock;
+
+	err = jl2xxx_pre_init(phydev, patch, mode);
+unlock:
+	mutex_unlock(&pbus->lock);
+
+	return err;
+}
+
+int jl1xxx_wol_dynamic_op_get(struct phy_device *phydev)
+{
+	return jlsemi_fetch_bit(phydev, JL1XXX_PAGE129,
+				JL1XXX_WOL_CTRL_REG, JL1XXX_WOL_DIS);
+}
+
+int jl2xxx_wol_dynamic_op_get(struct phy_device *phydev)
+{
+	return jlsemi_fetch_bit(phydev, JL2XXX_WOL_CTRL_PAGE,
+				JL2XXX_WOL_CTRL_REG, JL2XXX_WOL_EN);
+}
+
+static int jl1xxx_wol_static_op_set(struct phy_device *phydev)
+{
+	int err;
+
+	err = jl1xxx_wol_dynamic_op_set(phydev);
+	if (err < 0)
+		return err;
+
+	return 0;
+}
+
+int jl1xxx_intr_ack_event(struct phy_device *phydev)
+{
+	struct jl1xxx_priv *priv = phydev->priv;
+	int status;
+
+	if (!(priv->intr.enable & JL1XXX_INTR_STATIC_OP_EN))
+		return 0;
+
+	status = phy_read(phydev, JL1XXX_INTR_STATUS_REG);
+	trace_jlsemi_intr_ack(jlsemi_trace_dev(phydev), status);
+
+	return status;
+}
+
+u16 jl1xxx_intr_mask(struct phy_device *phydev)
+{
+	struct jl1xxx_priv *priv = phydev->priv;
+	u16 mask = 0;
+
+	if (priv->intr.enable & JL1XXX_INTR_LINK_CHANGE_EN)
+		mask |= JL1XXX_INTR_LINK;
+	if (priv->intr.enable & JL1XXX_INTR_AN_ERR_EN)
+		mask |= JL1XXX_INTR_AN_ERR;
+
+	return mask;
+}
+
+static void jl1xxx_intr_static_op_build(struct phy_device *phydev,
+					struct jl_reg_txn *txn)
+{
+	struct jl1xxx_priv *priv = phydev->priv;
+
+	/* Sources masked by a storm stay masked until it is over */
+	jlsemi_txn_modify(txn, JL1XXX_PAGE7, JL1XXX_INTR_REG,
+			  priv->intr.sources,
+			  priv->intr.mask & ~priv->intr.masked);
+}
+
+int jl1xxx_intr_static_op_set(struct phy_device *phydev)
+{
+	struct jl_reg_txn txn;
+
+	jlsemi_txn_init(&txn);
+	jl1xxx_intr_static_op_build(phydev, &txn);
+
+	return jlsemi_txn_commit(phydev, &txn);
+}
+
+int jl1xxx_intr_disable(struct phy_device *phydev)
+{
+	struct jl1xxx_priv *priv = phydev->priv;
+
+	return jlsemi_clear_bits(phydev, JL1XXX_PAGE7, JL1XXX_INTR_REG,
+				 priv->intr.sources);
+}
+
+static int jl2xxx_wol_static_op_set(struct phy_device *phydev)
+{
+	int err;
+
+	err = jl2xxx_wol_dynamic_op_set(phydev);
+	if (err < 0)
+		return err;
+
+	return 0;
+}
+
+int jl1xxx_wol_dynamic_op_set(struct phy_device *phydev)
+{
+	int err;
+
+	err = jl1xxx_wol_cfg_rmii(phydev);
+	if (err < 0)
+		return err;
+
+	err = jl1xxx_wol_enable(phydev, true);
+	if (err < 0)
+		return err;
+
+	err = jl1xxx_wol_store_mac_addr(phydev);
+	if (err < 0)
+		return err;
+
+	err = jl1xxx_wol_event_clear(phydev);
+	if (err < 0)
+		return err;
+
+	return 0;
+}
+
+/**
+ * jl1xxx_wol_event_clear() - clear a latched wake-up event
+ * @phydev: a pointer to a &struct phy_device
+ *
+ * The event is counted in the phy_wol_events statistic.
+ */
+int jl1xxx_wol_event_clear(struct phy_device *phydev)
+{
+	struct jl1xxx_priv *priv = phydev->priv;
+
+	if (!jl1xxx_wol_receive_check(phydev))
+		return 0;
+
+	jlsemi_stats_event(&priv->stats, JLSEMI_SOFT_WOL);
+
+	return jl1xxx_wol_clear(phydev);
+}
+
+int jl2xxx_wol_dynamic_op_set(struct phy_device *phydev)
+{
+	int err;
+
+	err = jl2xxx_wol_enable(phydev, true);
+	if (err < 0)
+		return err;
+
+	err = jl2xxx_wol_clear(phydev);
+	if (err < 0)
+		return err;
+
+	err = jl2xxx_wol_active_low_polarity(phydev, true);
+	if (err < 0)
+		return err;
+
+	err = jl2xxx_store_mac_addr(phydev);
+	if (err < 0)
+		return err;
+
+	return 0;
+}
+
+int jl2xxx_intr_ack_event(struct phy_device *phydev)
+{
+	int status;
+
+	status = jlsemi_read_paged(phydev, JL2XXX_PAGE2627,
+				   JL2XXX_INTR_STATUS_REG);
+	trace_jlsemi_intr_ack(jlsemi_trace_dev(phydev), status);
+
+	return status;
+}
+
+u16 jl2xxx_intr_mask(struct phy_device *phydev)
+{
+	struct jl2xxx_priv *priv = phydev->priv;
+	u16 mask = 0;
+
+	if (priv->intr.enable & JL2XXX_INTR_LINK_CHANGE_EN)
+		mask |= JL2XXX_INTR_LINK_CHANGE;
+	if (priv->intr.enable & JL2XXX_INTR_AN_ERR_EN)
+		mask |= JL2XXX_INTR_AN_ERR;
+	if (priv->intr.enable & JL2XXX_INTR_AN_COMPLETE_EN)
+		mask |= JL2XXX_INTR_AN_COMPLETE;
+	if (priv->intr.enable & JL2XXX_INTR_AN_PAGE_RECE)
+		mask |= JL2XXX_INTR_AN_PAGE;
+
+	return mask;
+}
+
+static void jl2xxx_intr_static_op_build(struct phy_device *phydev,
+					struct jl_reg_txn *txn)
+{
+	struct jl2xxx_priv *priv = phydev->priv;
+
+	/* Sources masked by a storm stay masked until it is over */
+	jlsemi_txn_modify(txn, JL2XXX_PAGE2626, JL2XXX_INTR_CTRL_REG,
+			  priv->intr.sources,
+			  priv->intr.mask & ~priv->intr.masked);
+	jlsemi_txn_set_bits(txn, JL2XXX_PAGE158,
+			    JL2XXX_INTR_PIN_REG,
+			    JL2XXX_INTR_PIN_EN);
+	jlsemi_txn_set_bits(txn, JL2XXX_PAGE160,
+			    JL2XXX_PIN_EN_REG,
+			    JL2XXX_PIN_OUTPUT);
+}
+
+int jl2xxx_intr_static_op_set(struct phy_device *phydev)
+{
+	struct jl_reg_txn txn;
+
+	jlsemi_txn_init(&txn);
+	jl2xxx_intr_static_op_build(phydev, &txn);
+
+	return jlsemi_txn_commit(phydev, &txn);
+}
+
+int jl2xxx_intr_disable(struct phy_device *phydev)
+{
+	struct jl2xxx_priv *priv = phydev->priv;
+
+	/* Leave the pin routing alone, only stop the event sources */
+	return jlsemi_clear_bits(phydev, JL2XXX_PAGE2626,
+				 JL2XXX_INTR_CTRL_REG,
+				 priv->intr.sources);
+}
+
+/* Shared interrupt lines, guarded by jlsemi_intr_lock */
+static LIST_HEAD(jlsemi_intr_lines);
+static DEFINE_MUTEX(jlsemi_intr_lock);
+
+static void jlsemi_intr_kick(struct phy_device *phydev)
+{
+#if (JLSEMI_PHY_MAC_INTR_LINK)
+	phy_mac_interrupt(phydev, phydev->link);
+#else
+	phy_mac_interrupt(phydev);
+#endif
+}
+
+/**
+ * __jlsemi_intr_account() - Rate account one interrupt of a phy
+ * @intr: interrupt control of the phy
+ * @status: enabled sources of the interrupt status register
+ *
+ * Note:
+ * called with jlsemi_intr_lock held. Once a phy interrupts more than
+ * JLSEMI_INTR_STORM_EVENTS times in a window, the sources seen in that
+ * window are masked in the control register and the static script, and
+ * the phy is polled until the quiet period is over.
+ *
+ * Return: true if the phy has just been switched to polling
+ */
+static bool __jlsemi_intr_account(struct jl_intr_ctrl *intr, int status)
+{
+	struct jl_core_ctrl *core = jlsemi_core_ctrl(intr->phydev);
+	unsigned long quiet;
+	int err;
+
+	intr->events++;
+	if (time_after(jiffies, intr->window_start +
+		       msecs_to_jiffies(JLSEMI_INTR_STORM_WINDOW_MS))) {
+		/* A calm window ends the storms in a row */
+		if (!intr->storm)
+			intr->backoff = 0;
+		intr->window_start = jiffies;
+		intr->window_events = 0;
+		intr->window_seen = 0;
+	}
+
+	intr->window_events++;
+	intr->window_seen |= status;
+	if (intr->storm || intr->window_events <= JLSEMI_INTR_STORM_EVENTS)
+		return false;
+
+	err = jlsemi_clear_bits(intr->phydev, intr->ctrl_page,
+				intr->ctrl_reg, intr->window_seen);
+	if (err < 0)
+		return false;
+	jlsemi_script_update(intr->phydev, &core->script, intr->ctrl_page,
+			     intr->ctrl_reg, intr->window_seen, 0);
+
+	quiet = JLSEMI_INTR_STORM_QUIET_MS << intr->backoff;
+	if (intr->backoff < JLSEMI_INTR_STORM_BACKOFF_MAX)
+		intr->backoff++;
+
+	intr->storm = true;
+	intr->storms++;
+	intr->masked = intr->window_seen;
+	intr->quiet_end = jiffies + msecs_to_jiffies(quiet);
+	schedule_delayed_work(&intr->storm_work,
+			      msecs_to_jiffies(JLSEMI_INTR_STORM_POLL_MS));
+
+	JLSEMI_PHY_MSG(KERN_WARNING
+		       "%s: %u interrupts in %d ms, masked 0x%04x for %lu ms\n",
+		       __func__, intr->window_events,
+		       JLSEMI_INTR_STORM_WINDOW_MS, intr->masked, quiet);
+
+	return true;
+}
+
+/**
+ * jlsemi_intr_account() - Rate account one interrupt of a phy
+ * @intr: interrupt control of the phy
+ * @status: enabled sources of the interrupt status register
+ *
+ * Return: true if the phy has just been switched to polling
+ */
+bool jlsemi_intr_account(struct jl_intr_ctrl *intr, int status)
+{
+	bool storm;
+
+	mutex_lock(&jlsemi_intr_lock);
+	storm = __jlsemi_intr_account(intr, status);
+	mutex_unlock(&jlsemi_intr_lock);
+
+	return storm;
+}
+
+static void jlsemi_intr_storm_work(struct work_struct *work)
+{
+	struct jl_intr_ctrl *intr = container_of(to_delayed_work(work),
+						 struct jl_intr_ctrl,
+						 storm_work);
+	struct phy_device *phydev = intr->phydev;
+	struct jl_core_ctrl *core = jlsemi_core_ctrl(phydev);
+	int err;
+
+	jlsemi_intr_kick(phydev);
+
+	mutex_lock(&jlsemi_intr_lock);
+	if (time_before(jiffies, intr->quiet_end))
+		goto poll;
+
+	/* Drop what latched while masked, then unmask */
+	err = jlsemi_read_paged(phydev, intr->page, intr->reg);
+	if (err >= 0)
+		err = jlsemi_set_bits(phydev, intr->ctrl_page,
+				      intr->ctrl_reg,
+				      intr->masked & intr->mask);
+	if (err < 0)
+		goto poll;
+	jlsemi_script_update(phydev, &core->script, intr->ctrl_page,
+			     intr->ctrl_reg, intr->masked, intr->mask);
+
+	intr->storm = false;
+	intr->masked = 0;
+	intr->window_start = jiffies;
+	intr->window_events = 0;
+	intr->window_seen = 0;
+	mutex_unlock(&jlsemi_intr_lock);
+
+	return;
+
+poll:
+	mutex_unlock(&jlsemi_intr_lock);
+	schedule_delayed_work(&intr->storm_work,
+			      msecs_to_jiffies(JLSEMI_INTR_STORM_POLL_MS));
+}
+
+/**
+ * jlsemi_intr_storm_cancel() - Stop polling a phy for good
+ * @intr: interrupt control of the phy
+ */
+void jlsemi_intr_storm_cancel(struct jl_intr_ctrl *intr)
+{
+	cancel_delayed_work_sync(&intr->storm_work);
+}
+
+/**
+ * jlsemi_intr_storm_stop() - End a storm when the interrupts go away
+ * @intr: interrupt control of the phy
+ * @unmask: enable the masked sources again in the control register
+ *
+ * Note:
+ * used when the interrupts are disabled or the phy is suspended, so that
+ * the poll work neither kicks a stopped phy nor enables sources behind
+ * the back of config_intr. The static script gets the configured sources
+ * back and the next storm starts without backoff.
+ */
+void jlsemi_intr_storm_stop(struct jl_intr_ctrl *intr, bool unmask)
+{
+	struct phy_device *phydev = intr->phydev;
+	struct jl_core_ctrl *core = jlsemi_core_ctrl(phydev);
+
+	cancel_delayed_work_sync(&intr->storm_work);
+
+	mutex_lock(&jlsemi_intr_lock);
+	if (intr->storm) {
+		if (unmask)
+			jlsemi_set_bits(phydev, intr->ctrl_page,
+					intr->ctrl_reg,
+					intr->masked & intr->mask);
+		jlsemi_script_update(phydev, &core->script, intr->ctrl_page,
+				     intr->ctrl_reg, intr->masked, intr->mask);
+	}
+
+	intr->storm = false;
+	intr->masked = 0;
+	intr->backoff = 0;
+	intr->window_start = jiffies;
+	intr->window_events = 0;
+	intr->window_seen = 0;
+	mutex_unlock(&jlsemi_intr_lock);
+}
+
+/**
+ * jlsemi_intr_mask_set() - Replace the enabled interrupt sources
+ * @intr: interrupt control of the phy
+ * @mask: new sources, a subset of intr->sources
+ *
+ * Note:
+ * the whole source field of the control register is rewritten with a
+ * single write, sources masked by a running storm stay masked until it
+ * is over. The entry of the static script is updated as well, so that a
+ * re-init or resume keeps the new mask.
+ *
+ * Return: 0 or negative errno
+ */
+int jlsemi_intr_mask_set(struct jl_intr_ctrl *intr, u16 mask)
+{
+	struct phy_device *phydev = intr->phydev;
+	struct jl_core_ctrl *core = jlsemi_core_ctrl(phydev);
+	int err;
+
+	if (mask & ~intr->sources)
+		return -EINVAL;
+
+	mutex_lock(&jlsemi_intr_lock);
+	err = jlsemi_modify_paged_reg(phydev, intr->ctrl_page,
+				      intr->ctrl_reg, intr->sources,
+				      mask & ~intr->masked);
+	if (err < 0)
+		goto unlock;
+
+	intr->mask = mask;
+	jlsemi_script_update(phydev, &core->script, intr->ctrl_page,
+			     intr->ctrl_reg, intr->sources,
+			     mask & ~intr->masked);
+
+unlock:
+	mutex_unlock(&jlsemi_intr_lock);
+
+	return err < 0 ? err : 0;
+}
+
+static irqreturn_t jlsemi_intr_line_thread(int irq, void *data)
+{
+	struct jl_intr_line *line = data;
+	struct jl_intr_ctrl *intr;
+	irqreturn_t ret = IRQ_NONE;
+	bool defer = false;
+	int status;
+
+	mutex_lock(&jlsemi_intr_lock);
+	list_for_each_entry(intr, &line->phys, node) {
+		status = jlsemi_read_paged(intr->phydev, intr->page,
+					   intr->reg);
+		if (status < 0)
+			continue;
+
+		status &= intr->mask;
+		if (!status)
+			continue;
+
+		ret = IRQ_HANDLED;
+		__jlsemi_intr_account(intr, status);
+		if (!(status & intr->link))
+			continue;
+
+		if (line->coalesce) {
+			intr->pending = true;
+			defer = true;
+		} else {
+			jlsemi_intr_kick(intr->phydev);
+		}
+	}
+	mutex_unlock(&jlsemi_intr_lock);
+
+	/* Later events of a burst fold into the window already running */
+	if (defer)
+		schedule_delayed_work(&line->work,
+				      msecs_to_jiffies(line->coalesce));
+
+	return ret;
+}
+
+static void jlsemi_intr_line_work(struct work_struct *work)
+{
+	struct jl_intr_line *line = container_of(to_delayed_work(work),
+						 struct jl_intr_line, work);
+	struct jl_intr_ctrl *intr;
+
+	mutex_lock(&jlsemi_intr_lock);
+	list_for_each_entry(intr, &line->phys, node) {
+		if (!intr->pending)
+			continue;
+
+		intr->pending = false;
+		jlsemi_intr_kick(intr->phydev);
+	}
+	mutex_unlock(&jlsemi_intr_lock);
+}
+
+/**
+ * jlsemi_intr_line_attach() - Join the shared interrupt line of a phy
+ * @phydev: a pointer to a &struct phy_device
+ * @intr: interrupt control of the phy, page/reg/mask/link filled in
+ *
+ * Note:
+ * the first phy on an irq requests it, the others only join the list
+ * its handler scans. phylib neither requests the irq nor polls the phy
+ * afterwards, the line kicks its state machine instead.
+ *
+ * Return: 0 or negative errno
+ */
+static int jlsemi_intr_line_attach(struct phy_device *phydev,
+				   struct jl_intr_ctrl *intr)
+{
+	struct jl_intr_line *line;
+	int err = 0;
+
+	mutex_lock(&jlsemi_intr_lock);
+	list_for_each_entry(line, &jlsemi_intr_lines, node) {
+		if (line->irq == phydev->irq)
+			goto join;
+	}
+
+	line = kzalloc(sizeof(*line), GFP_KERNEL);
+	if (!line) {
+		err = -ENOMEM;
+		goto unlock;
+	}
+
+	line->irq = phydev->irq;
+	INIT_LIST_HEAD(&line->phys);
+	INIT_DELAYED_WORK(&line->work, jlsemi_intr_line_work);
+
+	err = request_threaded_irq(line->irq, NULL, jlsemi_intr_line_thread,
+				   IRQF_ONESHOT | IRQF_SHARED, "jlsemi-phy",
+				   line);
+	if (err < 0) {
+		JLSEMI_PHY_MSG(KERN_ERR "%s: request irq %d failed %d\n",
+			       __func__, line->irq, err);
+		kfree(line);
+		goto unlock;
+	}
+	list_add_tail(&line->node, &jlsemi_intr_lines);
+
+join:
+	intr->line = line;
+	intr->pending = false;
+	line->coalesce = max(line->coalesce, intr->coalesce);
+	list_add_tail(&intr->node, &line->phys);
+	phydev->irq = PHY_MAC_INTERRUPT;
+
+unlock:
+	mutex_unlock(&jlsemi_intr_lock);
+
+	return err;
+}
+
+/**
+ * jlsemi_intr_line_detach() - Leave the shared interrupt line
+ * @intr: interrupt control of the phy
+ *
+ * The last phy on the line frees the irq.
+ */
+void jlsemi_intr_line_detach(struct jl_intr_ctrl *intr)
+{
+	struct jl_intr_line *line = intr->line;
+	bool last;
+
+	if (!line)
+		return;
+
+	mutex_lock(&jlsemi_intr_lock);
+	list_del(&intr->node);
+	intr->line = NULL;
+	last = list_empty(&line->phys);
+	if (last)
+		list_del(&line->node);
+	mutex_unlock(&jlsemi_intr_lock);
+
+	if (!last)
+		return;
+
+	free_irq(line->irq, line);
+	cancel_delayed_work_sync(&line->work);
+	kfree(line);
+}
+
+int jl1xxx_intr_line_attach(struct phy_device *phydev)
+{
+	struct jl1xxx_priv *priv = phydev->priv;
+	struct jl_intr_ctrl *intr = &priv->intr;
+
+	if (!(intr->enable & JL1XXX_INTR_SHARED_EN) || phydev->irq <= 0)
+		return 0;
+
+	return jlsemi_intr_line_attach(phydev, intr);
+}
+
+int jl2xxx_intr_line_attach(struct phy_device *phydev)
+{
+	struct jl2xxx_priv *priv = phydev->priv;
+	struct jl_intr_ctrl *intr = &priv->intr;
+
+	if (!(intr->enable & JL2XXX_INTR_SHARED_EN) || phydev->irq <= 0)
+		return 0;
+
+	return jlsemi_intr_line_attach(phydev, intr);
+}
+
+int jl1xxx_operation_args_get(struct phy_device *phydev)
+{
+	jl1xxx_led_operation_args(phydev);
+	jl1xxx_wol_operation_args(phydev);
+	jl1xxx_intr_operation_args(phydev);
+	jl1xxx_mdi_operation_args(phydev);
+	jl1xxx_rmii_operation_args(phydev);
+
+	return 0;
+}
+
+int jl2xxx_operation_args_get(struct phy_device *phydev)
+{
+	jl2xxx_led_operation_args(phydev);
+	jl2xxx_fld_operation_args(phydev);
+	jl2xxx_wol_operation_args(phydev);
+	jl2xxx_intr_operation_args(phydev);
+	jl2xxx_downshift_operation_args(phydev);
+	jl2xxx_rgmii_operation_args(phydev);
+	jl2xxx_patch_operation_args(phydev);
+	jl2xxx_clk_operation_args(phydev);
+	jl2xxx_work_mode_operation_args(phydev);
+	jl2xxx_lpbk_operation_args(phydev);
+	jl2xxx_slew_rate_operation_args(phydev);
+	jl2xxx_rxc_out_operation_args(phydev);
+	jl2xxx_async_init_operation_args(phydev);
+
+	return 0;
+}
+
+/* Queue one static operation into the script */
+static void jlsemi_script_build(struct phy_device *phydev,
+				struct jl_reg_script *script,
+				void (*build)(struct phy_device *phydev,
+					      struct jl_reg_txn *txn))
+{
+	struct jl_reg_txn txn;
+
+	jlsemi_txn_init(&txn);
+	build(phydev, &txn);
+	jlsemi_script_add(script, &txn);
+}
+
+/**
+ * jl1xxx_script_compile() - compile the register settings of the static
+ * operations
+ * @phydev: a pointer to a &struct phy_device
+ *
+ * Run once at probe, the script is replayed by the static init and on
+ * resume. WOL depends on the attached netdev and is not part of it.
+ */
+int jl1xxx_script_compile(struct phy_device *phydev)
+{
+	struct jl1xxx_priv *priv = phydev->priv;
+	struct jl_reg_script *script = &priv->core.script;
+
+	jlsemi_script_init(script);
+
+	if (priv->led.enable & JL1XXX_LED_STATIC_OP_EN)
+		jlsemi_script_build(phydev, script,
+				    jl1xxx_led_static_op_build);
+
+	if (priv->intr.enable & JL1XXX_INTR_STATIC_OP_EN)
+		jlsemi_script_build(phydev, script,
+				    jl1xxx_intr_static_op_build);
+
+	if (priv->mdi.enable & JL1XXX_MDI_STATIC_OP_EN)
+		jlsemi_script_build(phydev, script,
+				    jl1xxx_mdi_static_op_build);
+
+	if (priv->rmii.enable & JL1XXX_RMII_STATIC_OP_EN)
+		jlsemi_script_build(phydev, script,
+				    jl1xxx_rmii_static_op_build);
+
+	return jlsemi_script_finish(script);
+}
+
+int jl1xxx_static_op_init(struct phy_device *phydev)
+{
+	struct jl1xxx_priv *priv = phydev->priv;
+	int err;
+
+	/* WOL switches to rmii mode, the rmii settings go on top of it */
+	if (priv->wol.enable & JL1XXX_WOL_STATIC_OP_EN) {
+		err = jl1xxx_wol_static_op_set(phydev);
+		if (err < 0)
+			return err;
+	}
+
+	return jlsemi_script_run(phydev, &priv->core.script, true);
+}
+
+/**
+ * jl2xxx_script_compile() - compile the register settings of the static
+ * operations
+ * @phydev: a pointer to a &struct phy_device
+ *
+ * Run once at probe, the script is replayed by the static init and on
+ * resume. The patch, WOL, the loopbacks and rxc_out are sequences that
+ * depend on the phy state or have to follow its reset, they stay out of
+ * it.
+ */
+int jl2xxx_script_compile(struct phy_device *phydev)
+{
+	struct jl2xxx_priv *priv = phydev->priv;
+	struct jl_reg_script *script = &priv->core.script;
+
+	jlsemi_script_init(script);
+
+	if (priv->led.enable & JL2XXX_LED_STATIC_OP_EN)
+		jlsemi_script_build(phydev, script,
+				    jl2xxx_led_static_op_build);
+
+	if (priv->fld.enable & JL2XXX_FLD_STATIC_OP_EN)
+		jlsemi_script_build(phydev, script,
+				    jl2xxx_fld_static_op_build);
+
+	if (priv->intr.enable & JL2XXX_INTR_STATIC_OP_EN)
+		jlsemi_script_build(phydev, script,
+				    jl2xxx_intr_static_op_build);
+
+	if (priv->downshift.enable & JL2XXX_DSFT_STATIC_OP_EN)
+		jlsemi_script_build(phydev, script,
+				    jl2xxx_downshift_static_op_build);
+
+	if (priv->rgmii.enable & JL2XXX_RGMII_STATIC_OP_EN)
+		jlsemi_script_build(phydev, script,
+				    jl2xxx_rgmii_static_op_build);
+
+	if (priv->clk.enable & JL2XXX_CLK_STATIC_OP_EN)
+		jlsemi_script_build(phydev, script,
+				    jl2xxx_clk_static_op_build);
+
+	if (priv->work_mode.enable & JL2XXX_WORK_MODE_STATIC_OP_EN)
+		jlsemi_script_build(phydev, script,
+				    jl2xxx_work_mode_static_op_build);
+
+	if (priv->slew_rate.enable & JL2XXX_SLEW_RATE_STATIC_OP_EN)
+		jlsemi_script_build(phydev, script,
+				    jl2xxx_slew_rate_static_op_build);
+
+	/* Delays, clock output and work mode take effect on a reset */
+	if ((priv->rgmii.enable & JL2XXX_RGMII_STATIC_OP_EN) ||
+	    (priv->clk.enable & JL2XXX_CLK_STATIC_OP_EN) ||
+	    (priv->work_mode.enable & JL2XXX_WORK_MODE_STATIC_OP_EN))
+		jlsemi_script_barrier(script, JLSEMI_SCRIPT_OP_RESET, 0);
+
+	return jlsemi_script_finish(script);
+}
+
+static int __jl2xxx_static_op_init(struct phy_device *phydev)
+{
+	struct jl2xxx_priv *priv = phydev->priv;
+	int err;
+
+	if (priv->patch.enable & JL2XXX_PATCH_STATIC_OP_EN) {
+		err = jl2xxx_patch_static_op_set(phydev);
+		if (err < 0)
+			return err;
+	}
+
+	err = jlsemi_script_run(phydev, &priv->core.script, true);
+	if (err < 0)
+		return err;
+
+	if (priv->wol.enable & JL2XXX_WOL_STATIC_OP_EN) {
+		err = jl2xxx_wol_static_op_set(phydev);
+		if (err < 0)
+			return err;
+	}
+
+	if (priv->lpbk.enable & JL2XXX_LPBK_STATIC_OP_EN) {
+		err = jl2xxx_lpbk_static_op_set(phydev);
+		if (err < 0)
+			return err;
+	}
+
+	if (priv->rxc_out.enable & JL2XXX_RXC_OUT_STATIC_OP_EN) {
+		/* The temporary utp<-->rgmii mode has to be applied on top
+		 * of the configuration above, so reset that in first.
+		 */
+		err = jlsemi_reset_barrier(phydev);
+		if (err < 0)
+			return err;
+
+		err = jl2xxx_rxc_out_static_op_set(phydev);
+		if (err < 0)
+			return err;
+	}
+
+	return 0;
+}
+
+int jl2xxx_static_op_init(struct phy_device *phydev)
+{
+	int err, ret;
+
+	/* Static operations only request a soft reset, a single one is
+	 * issued once all registers have been written.
+	 */
+	jlsemi_defer_reset(phydev);
+	err = __jl2xxx_static_op_init(phydev);
+	ret = jlsemi_flush_reset(phydev);
+
+	return err < 0 ? err : ret;
+}
+
+static void jl2xxx_async_init_work(struct work_struct *work)
+{
+	struct jl_async_init_ctrl *async_init =
+		container_of(work, struct jl_async_init_ctrl, work);
+	struct phy_device *phydev = async_init->phydev;
+	struct jl2xxx_priv *priv = phydev->priv;
+	int pending;
+	int acct;
+	int err;
+
+	/* Requests made while this runs queue the work once more */
+	pending = atomic_read(&async_init->pending);
+	if (!pending)
+		return;
+
+	acct = jlsemi_acct_begin(phydev, JLSEMI_ACCT_CONFIG_INIT);
+	err = jl2xxx_static_op_init(phydev);
+	jlsemi_acct_end(phydev, acct);
+	if (err < 0)
+		JLSEMI_PHY_MSG(KERN_ERR "%s: static init failed %d\n",
+			       __func__, err);
+
+	/* Published with the requests it served, the sub is a barrier */
+	async_init->err = err;
+	if (atomic_sub_return(pending, &async_init->pending))
+		return;
+
+	/* The patch and software versions may have changed */
+	jlsemi_stats_start(phydev, &priv->stats);
+
+	/* The phy callbacks may run under phydev->lock and wait for us,
+	 * so only kick the state machine. Autoneg held off until now is
+	 * started by the next read_status.
+	 */
+	if (err >= 0)
+		jlsemi_intr_kick(phydev);
+}
+
+/**
+ * jl2xxx_async_init_start() - run the static operations on a workqueue
+ * @phydev: a pointer to a &struct phy_device
+ *
+ * Until they finish, jl2xxx_async_init_status() returns 0 and the phy
+ * callbacks report the link as down. Never waits for a previous run, a
+ * run that is queued or in flight picks the request up.
+ */
+int jl2xxx_async_init_start(struct phy_device *phydev)
+{
+	struct jl2xxx_priv *priv = phydev->priv;
+	struct jl_async_init_ctrl *async_init = &priv->async_init;
+
+	atomic_inc(&async_init->pending);
+	/* Not harvested across the reset, restarted by the work */
+	jlsemi_stats_stop(&priv->stats);
+	queue_work(system_unbound_wq, &async_init->work);
+
+	return 0;
+}
+
+/**
+ * jl2xxx_async_init_status() - check the asynchronous static init
+ * @phydev: a pointer to a &struct phy_device
+ *
+ * Return: 1 if the init has finished or is synchronous, 0 while it is
+ * still running and negative errno if it failed
+ */
+int jl2xxx_async_init_status(struct phy_device *phydev)
+{
+	struct jl2xxx_priv *priv = phydev->priv;
+	struct jl_async_init_ctrl *async_init = &priv->async_init;
+
+	if (!(async_init->enable & JL2XXX_ASYNC_INIT_STATIC_OP_EN))
+		return 1;
+
+	if (atomic_read(&async_init->pending))
+		return 0;
+	smp_rmb();
+
+	return async_init->err < 0 ? async_init->err : 1;
+}
+
+/**
+ * jl2xxx_async_init_flush() - wait for the asynchronous static init
+ * @phydev: a pointer to a &struct phy_device
+ */
+void jl2xxx_async_init_flush(struct phy_device *phydev)
+{
+	struct jl2xxx_priv *priv = phydev->priv;
+
+	flush_work(&priv->async_init.work);
+}
+
+/**
+ * jl2xxx_async_init_cancel() - stop the asynchronous static init
+ * @phydev: a pointer to a &struct phy_device
+ */
+void jl2xxx_async_init_cancel(struct phy_device *phydev)
+{
+	struct jl2xxx_priv *priv = phydev->priv;
+
+	cancel_work_sync(&priv->async_init.work);
+}
+
+int jl2xxx_pre_init(struct phy_device *phydev, struct jl_patch *patch,
+		    int mode)
+{
+	struct jl2xxx_priv *priv = phydev->priv;
+	bool check;
+	int acct;
+	int err;
+
+	check = patch->check(phydev, patch, mode);
+	if (!check)
+		return 0;
+
+	/* Re-attach, the patch is still running */
+	if (patch->active && patch->active(phydev, patch))
+		return 1;
+
+	acct = jlsemi_acct_begin(phydev, JLSEMI_ACCT_PATCH_LOAD);
+	err = patch->load(phydev, patch);
+	if (err >= 0)
+		patch->verify(phydev, patch);
+	jlsemi_acct_end(phydev, acct);
+	if (err < 0)
+		return err;
+	priv->patch.loaded = patch;
+
+	return 1;
+}
+
+/**
+ * jl2xxx_patch_forget() - assume the patch is gone
+ * @phydev: a pointer to a &struct phy_device
+ *
+ * For when the phy may lose power, the next static init downloads the
+ * patch again unless its version register proves otherwise.
+ */
+void jl2xxx_patch_forget(struct phy_device *phydev)
+{
+	struct jl2xxx_priv *priv = phydev->priv;
+
+	priv->patch.loaded = NULL;
+}
+
+/**
+ * jl2xxx_patch_lost() - check whether the patch survived a suspend
+ * @phydev: a pointer to a &struct phy_device
+ *
+ * A patch that is no longer running means the phy lost power and has to
+ * be set up from scratch. Patches without a version register can not
+ * prove they are running and always count as lost.
+ *
+ * Returns negative errno, 1 if the patch was lost, 0 otherwise.
+ */
+int jl2xxx_patch_lost(struct phy_device *phydev)
+{
+	struct jl2xxx_priv *priv = phydev->priv;
+	struct jl_patch *patch;
+	int mode;
+	int err;
+
+	if (!(priv->patch.enable & JL2XXX_PATCH_STATIC_OP_EN))
+		return 0;
+
+	mutex_lock(&priv->patch.bus->lock);
+	err = jl2xxx_patch_prepare(phydev);
+	if (err < 0)
+		goto unlock;
+
+	err = jl2xxx_patch_find(phydev, &patch, &mode);
+	if (err < 0 || !patch)
+		goto unlock;
+
+	err = !(patch->active && patch->active(phydev, patch));
+unlock:
+	mutex_unlock(&priv->patch.bus->lock);
+
+	return err;
+}
+
+static void jlsemi_soft_reset_wait(struct phy_device *phydev)
+{
+	unsigned long timeout;
+	int val;
+
+	if (!JLSEMI_SOFT_RESET_POLL) {
+		msleep(JL2XXX_SOFT_RESET_DELAY_MS);
+		return;
+	}
+
+	/* Give the mdio interface time to come back before polling */
+	msleep(JL2XXX_SOFT_RESET_SETTLE_MS);
+	timeout = jiffies + msecs_to_jiffies(JL2XXX_SOFT_RESET_DELAY_MS);
+	for (;;) {
+		val = jlsemi_read_paged(phydev, JL2XXX_PAGE0,
+					JL2XXX_BMCR_REG);
+		if (val >= 0 && !(val & JL2XXX_SOFT_RESET))
+			return;
+		if (time_after(jiffies, timeout))
+			break;
+		msleep(JL2XXX_SOFT_RESET_POLL_MS);
+	}
+
+	/* The full fixed delay has elapsed by now, carry on as before */
+	JLSEMI_PHY_MSG(KERN_WARNING "%s: soft reset poll timed out\n",
+		       __func__);
+}
+
+int jlsemi_soft_reset(struct phy_device *phydev)
+{
+	unsigned long start = jiffies;
+	int err;
+
+	err = jlsemi_set_bits(phydev, JL2XXX_PAGE0,
+			      JL2XXX_BMCR_REG, JL2XXX_SOFT_RESET);
+	if (err < 0) {
+		trace_jlsemi_soft_reset(jlsemi_trace_dev(phydev), err, 0);
+		return err;
+	}
+	/* Registers are back to their defaults after reset */
+	jlsemi_invalidate_cache(phydev);
+	jl2xxx_work_mode_forget(phydev);
+	/* Wait soft reset complete*/
+	jlsemi_soft_reset_wait(phydev);
+	trace_jlsemi_soft_reset(jlsemi_trace_dev(phydev), 0,
+				jiffies_to_msecs(jiffies - start));
+
+	return 0;
+}
+
+/********************** Convenience function for phy **********************/
+
+static inline struct mii_bus *jlsemi_get_bus(struct phy_device *phydev)
+{
+#if JLSEMI_DEV_COMPATIBLE
+	return phydev->bus;
+#else
+	return phydev->mdio.bus;
+#endif
+}
+
+static inline void jlsemi_lock_mdio_bus(struct phy_device *phydev)
+{
+	mutex_lock(&jlsemi_get_bus(phydev)->mdio_lock);
+}
+
+static inline void jlsemi_unlock_mdio_bus(struct phy_device *phydev)
+{
+	mutex_unlock(&jlsemi_get_bus(phydev)->mdio_lock);
+}
+
+#if (JLSEMI_MDIO_ACCT)
+/**
+ * jlsemi_acct_begin() - account the mdio cycles of this task to @op
+ * @phydev: a pointer to a &struct phy_device
+ * @op: JLSEMI_ACCT_*
+ *
+ * Note:
+ * cycles of other tasks on the same phy, e.g. the statistics harvester
+ * running next to read_status, keep going to their own operation or to
+ * JLSEMI_ACCT_OTHER.
+ *
+ * Return: what to hand to jlsemi_acct_end()
+ */
+int jlsemi_acct_begin(struct phy_device *phydev, int op)
+{
+	struct jl_core_ctrl *core = jlsemi_core_ctrl(phydev);
+	int prev;
+
+	if (!core)
+		return JLSEMI_ACCT_BUSY;
+
+	if (core->acct_task == current) {
+		prev = core->acct_op;
+	} else if (!cmpxchg(&core->acct_task, NULL, current)) {
+		prev = JLSEMI_ACCT_IDLE;
+	} else {
+		return JLSEMI_ACCT_BUSY;
+	}
+	core->acct_op = op;
+
+	return prev;
+}
+
+void jlsemi_acct_end(struct phy_device *phydev, int prev)
+{
+	struct jl_core_ctrl *core = jlsemi_core_ctrl(phydev);
+
+	if (prev == JLSEMI_ACCT_BUSY)
+		return;
+
+	if (prev == JLSEMI_ACCT_IDLE) {
+		core->acct_op = JLSEMI_ACCT_OTHER;
+		WRITE_ONCE(core->acct_task, NULL);
+	} else {
+		core->acct_op = prev;
+	}
+}
+
+/* Called with the mdio bus lock held, which also guards the counters */
+static inline void jlsemi_acct_add(struct phy_device *phydev, bool write,
+				   u64 start)
+{
+	struct jl_core_ctrl *core = jlsemi_core_ctrl(phydev);
+	struct jl_mdio_acct *acct;
+
+	if (!core)
+		return;
+
+	if (READ_ONCE(core->acct_task) == current)
+		acct = &core->acct[core->acct_op];
+	else
+		acct = &core->acct[JLSEMI_ACCT_OTHER];
+
+	if (write)
+		acct->writes++;
+	else
+		acct->reads++;
+	acct->ns += ktime_to_ns(ktime_get()) - start;
+}
+
+static inline void jlsemi_acct_page(struct phy_device *phydev)
+{
+	struct jl_core_ctrl *core = jlsemi_core_ctrl(phydev);
+
+	if (!core)
+		return;
+
+	if (READ_ONCE(core->acct_task) == current)
+		core->acct[core->acct_op].pages++;
+	else
+		core->acct[JLSEMI_ACCT_OTHER].pages++;
+}
+#else
+static inline void jlsemi_acct_add(struct phy_device *phydev, bool write,
+				   u64 start)
+{
+}
+
+static inline void jlsemi_acct_page(struct phy_device *phydev)
+{
+}
+#endif
+
+#if (JLSEMI_PHY_TRACE_ENABLED)
+#define jlsemi_trace_on(name)	trace_##name##_enabled()
+#else
+#define jlsemi_trace_on(name)	true
+#endif
+
+/* Only read the clock when somebody is going to look at it */
+static inline u64 jlsemi_mdio_start(bool trace)
+{
+	if (!JLSEMI_MDIO_ACCT && !trace)
+		return 0;
+
+	return ktime_to_ns(ktime_get());
+}
+
+/* The page the shadow holds, as seen by the tracepoints */
+static inline int jlsemi_trace_page(struct phy_device *phydev)
+{
+	struct jl_core_ctrl *core = jlsemi_core_ctrl(phydev);
+
+	return core ? core->page : JLSEMI_PAGE_UNKNOWN;
+}
+
+static inline int __jlsemi_bus_read(struct phy_device *phydev, u32 regnum)
+{
+#if (JLSEMI_PHY_UNLOCKED_ACCESS)
+	return __phy_read(phydev, regnum);
+#else
+	struct mii_bus *bus = jlsemi_get_bus(phydev);
+#if JLSEMI_DEV_COMPATIBLE
+	return bus->read(bus, phydev->addr, regnum);
+#else
+	return bus->read(bus, phydev->mdio.addr, regnum);
+#endif
+#endif
+}
+
+static inline int __jlsemi_bus_write(struct phy_device *phydev, u32 regnum,
+				     u16 val)
+{
+#if (JLSEMI_PHY_UNLOCKED_ACCESS)
+	return __phy_write(phydev, regnum, val);
+#else
+	struct mii_bus *bus = jlsemi_get_bus(phydev);
+#if JLSEMI_DEV_COMPATIBLE
+	return bus->write(bus, phydev->addr, regnum, val);
+#else
+	return bus->write(bus, phydev->mdio.addr, regnum, val);
+#endif
+#endif
+}
+
+/**
+ * __jlsemi_read() - read a register with the mdio bus lock held
+ * @phydev: a pointer to a &struct phy_device
+ * @regnum: register number
+ */
+static inline int __jlsemi_read(struct phy_device *phydev, u32 regnum)
+{
+	bool trace = jlsemi_trace_on(jlsemi_read);
+	u64 start = jlsemi_mdio_start(trace);
+	int ret;
+
+	ret = __jlsemi_bus_read(phydev, regnum);
+	jlsemi_acct_add(phydev, false, start);
+	if (trace)
+		trace_jlsemi_read(jlsemi_trace_dev(phydev),
+				  jlsemi_trace_page(phydev), regnum, ret, start);
+
+	return ret;
+}
+
+/**
+ * __jlsemi_write() - write a register with the mdio bus lock held
+ * @phydev: a pointer to a &struct phy_device
+ * @regnum: register number
+ * @val: value to write
+ */
+static inline int __jlsemi_write(struct phy_device *phydev, u32 regnum,
+				 u16 val)
+{
+	bool trace = jlsemi_trace_on(jlsemi_write);
+	u64 start = jlsemi_mdio_start(trace);
+	int ret;
+
+	ret = __jlsemi_bus_write(phydev, regnum, val);
+	jlsemi_acct_add(phydev, true, start);
+	if (trace)
+		trace_jlsemi_write(jlsemi_trace_dev(phydev),
+				   jlsemi_trace_page(phydev), regnum, val, start);
+
+	return ret;
+}
+
+/**
+ * __jlsemi_write_page() - select a page, skipping the write if the
+ * shadow already holds it
+ * @phydev: a pointer to a &struct phy_device
+ * @page: page values
+ */
+static inline int __jlsemi_write_page(struct phy_device *phydev, int page)
+{
+	struct jl_core_ctrl *core = jlsemi_core_ctrl(phydev);
+	int ret;
+
+	if (JLSEMI_PAGE_CACHE_EN && core && core->page == page)
+		return 0;
+
+	jlsemi_acct_page(phydev);
+	ret = __jlsemi_write(phydev, JLSEMI_PAGE31, page);
+	if (core)
+		core->page = (ret < 0) ? JLSEMI_PAGE_UNKNOWN : page;
+
+	return ret;
+}
+
+/**
+ * jlsemi_write_page() - write the page register
+ * @phydev: a pointer to a &struct phy_device
+ * @page: page values
+ */
+int jlsemi_write_page(struct phy_device *phydev, int page)
+{
+	int ret;
+
+	jlsemi_lock_mdio_bus(phydev);
+	ret = __jlsemi_write_page(phydev, page);
+	jlsemi_unlock_mdio_bus(phydev);
+
+	return ret;
+}
+
+/**
+ * jlsemi_read() - read a register of the current page
+ * @phydev: a pointer to a &struct phy_device
+ * @regnum: register number
+ *
+ * Same as phy_read(), but seen by the mdio accounting.
+ */
+int jlsemi_read(struct phy_device *phydev, u32 regnum)
+{
+	int ret;
+
+	jlsemi_lock_mdio_bus(phydev);
+	ret = __jlsemi_read(phydev, regnum);
+	jlsemi_unlock_mdio_bus(phydev);
+
+	return ret;
+}
+
+/**
+ * jlsemi_read_page() - read the page register
+ * @phydev: a pointer to a &struct phy_device
+ *
+ * The value is read from the phy and also resynchronizes the page shadow.
+ *
+ * Return: get page values at present
+ */
+int jlsemi_read_page(struct phy_device *phydev)
+{
+	struct jl_core_ctrl *core = jlsemi_core_ctrl(phydev);
+	int ret;
+
+	jlsemi_lock_mdio_bus(phydev);
+	ret = __jlsemi_read(phydev, JLSEMI_PAGE31);
+	if (core)
+		core->page = (ret < 0) ? JLSEMI_PAGE_UNKNOWN : ret;
+	jlsemi_unlock_mdio_bus(phydev);
+
+	return ret;
+}
+
+/**
+ * jlsemi_invalidate_cache() - forget the page shadow and cached registers
+ * @phydev: a pointer to a &struct phy_device
+ *
+ * Must be called whenever registers may have changed without going
+ * through the helpers below, e.g. after a reset or a patch download.
+ */
+void jlsemi_invalidate_cache(struct phy_device *phydev)
+{
+	struct jl_core_ctrl *core = jlsemi_core_ctrl(phydev);
+
+	if (core) {
+		core->page = JLSEMI_PAGE_UNKNOWN;
+		core->regs_valid = 0;
+	}
+}
+
+/**
+ * jlsemi_request_reset() - ask for a soft reset
+ * @phydev: a pointer to a &struct phy_device
+ *
+ * Between jlsemi_defer_reset() and jlsemi_flush_reset() the request is
+ * only recorded, otherwise the phy is reset at once.
+ */
+int jlsemi_request_reset(struct phy_device *phydev)
+{
+	struct jl_core_ctrl *core = jlsemi_core_ctrl(phydev);
+
+	if (core && core->reset_defer) {
+		core->reset_pending = true;
+		return 0;
+	}
+
+	return jlsemi_soft_reset(phydev);
+}
+
+/**
+ * jlsemi_defer_reset() - start batching soft reset requests
+ * @phydev: a pointer to a &struct phy_device
+ */
+void jlsemi_defer_reset(struct phy_device *phydev)
+{
+	struct jl_core_ctrl *core = jlsemi_core_ctrl(phydev);
+
+	if (core)
+		core->reset_defer = true;
+}
+
+/**
+ * jlsemi_reset_barrier() - issue the pending soft reset, if any
+ * @phydev: a pointer to a &struct phy_device
+ *
+ * For operations that must observe the registers written before them
+ * taking effect. Batching continues afterwards.
+ */
+int jlsemi_reset_barrier(struct phy_device *phydev)
+{
+	struct jl_core_ctrl *core = jlsemi_core_ctrl(phydev);
+
+	if (!core || !core->reset_pending)
+		return 0;
+
+	core->reset_pending = false;
+
+	return jlsemi_soft_reset(phydev);
+}
+
+/**
+ * jlsemi_flush_reset() - stop batching and issue the pending soft reset
+ * @phydev: a pointer to a &struct phy_device
+ */
+int jlsemi_flush_reset(struct phy_device *phydev)
+{
+	struct jl_core_ctrl *core = jlsemi_core_ctrl(phydev);
+	int err;
+
+	err = jlsemi_reset_barrier(phydev);
+	if (core)
+		core->reset_defer = false;
+
+	return err;
+}
+
+/**
+ * jlsemi_reg_volatile() - whether the phy updates a register by itself
+ * @phydev: a pointer to a &struct phy_device
+ * @page: the page for the phy
+ * @regnum: register number
+ */
+static bool jlsemi_reg_volatile(struct phy_device *phydev,
+				int page, u32 regnum)
+{
+	const struct jl_reg_key *volatiles;
+	int n_volatiles, i;
+
+	if ((phydev->phy_id & JLSEMI_PHY_ID_MASK) ==
+	    (JL1XXX_PHY_ID & JLSEMI_PHY_ID_MASK)) {
+		volatiles = jl1xxx_volatile_regs;
+		n_volatiles = ARRAY_SIZE(jl1xxx_volatile_regs);
+	} else {
+		volatiles = jl2xxx_volatile_regs;
+		n_volatiles = ARRAY_SIZE(jl2xxx_volatile_regs);
+	}
+
+	for (i = 0; i < n_volatiles; i++)
+		if (volatiles[i].page == page && volatiles[i].reg == regnum)
+			return true;
+
+	return false;
+}
+
+/**
+ * jlsemi_reg_cache_slot() - look up the cache slot of a register
+ * @phydev: a pointer to a &struct phy_device
+ * @page: the page for the phy
+ * @regnum: register number
+ *
+ * Return: the slot in &struct jl_core_ctrl regs, or -1 if the register
+ * is volatile or not cached
+ */
+static int jlsemi_reg_cache_slot(struct phy_device *phydev,
+				 int page, u32 regnum)
+{
+	const struct jl_reg_key *cached;
+	int n_cached, i;
+
+	BUILD_BUG_ON(ARRAY_SIZE(jl1xxx_cached_regs) > JLSEMI_REG_CACHE_MAX);
+	BUILD_BUG_ON(ARRAY_SIZE(jl2xxx_cached_regs) > JLSEMI_REG_CACHE_MAX);
+
+	if (!JLSEMI_REG_CACHE_EN || page < 0)
+		return -1;
+
+	if (jlsemi_reg_volatile(phydev, page, regnum))
+		return -1;
+
+	if ((phydev->phy_id & JLSEMI_PHY_ID_MASK) ==
+	    (JL1XXX_PHY_ID & JLSEMI_PHY_ID_MASK)) {
+		cached = jl1xxx_cached_regs;
+		n_cached = ARRAY_SIZE(jl1xxx_cached_regs);
+	} else {
+		cached = jl2xxx_cached_regs;
+		n_cached = ARRAY_SIZE(jl2xxx_cached_regs);
+	}
+
+	for (i = 0; i < n_cached; i++)
+		if (cached[i].page == page && cached[i].reg == regnum)
+			return i;
+
+	return -1;
+}
+
+/**
+ * __jlsemi_cached_noop() - check a modification against the register cache
+ * @phydev: a pointer to a &struct phy_device
+ * @page: the page for the phy
+ * @regnum: register number
+ * @mask: bit mask of bits to clear
+ * @set: bit mask of bits to set
+ *
+ * Return: true if the register is cached and would not change, in which
+ * case neither the page nor the register needs to be touched
+ */
+static inline bool __jlsemi_cached_noop(struct phy_device *phydev, int page,
+					u32 regnum, u16 mask, u16 set)
+{
+	struct jl_core_ctrl *core = jlsemi_core_ctrl(phydev);
+	int slot;
+
+	if (!core)
+		return false;
+
+	slot = jlsemi_reg_cache_slot(phydev, page, regnum);
+	if (slot < 0 || !(core->regs_valid & BIT(slot)))
+		return false;
+
+	return ((core->regs[slot] & ~mask) | set) == core->regs[slot];
+}
+
+/**
+ * __jlsemi_save_page() - save the page value
+ *@phydev: a pointer to a &struct phy_device
+ *
+ * Return: save page value
+ */
+static inline int __jlsemi_save_page(struct phy_device *phydev)
+{
+	struct jl_core_ctrl *core = jlsemi_core_ctrl(phydev);
+	int ret;
+
+	if (JLSEMI_PAGE_CACHE_EN && core && core->page >= 0)
+		return core->page;
+
+	ret = __jlsemi_read(phydev, JLSEMI_PAGE31);
+	if (core)
+		core->page = (ret < 0) ? JLSEMI_PAGE_UNKNOWN : ret;
+
+	return ret;
+}
+
+/**
+ * __jlsemi_select_page() - restore the page register
+ * @phydev: a pointer to a &struct phy_device
+ * @page: the page
+ *
+ * Return:
+ * @oldpgae: this is last page value
+ * @ret: if page is change it will return new page value
+ */
+static inline int __jlsemi_select_page(struct phy_device *phydev, int page)
+{
+	int ret, oldpage;
+
+	oldpage = ret = __jlsemi_save_page(phydev);
+	if (ret < 0)
+		return ret;
+
+	if (oldpage != page) {
+		ret = __jlsemi_write_page(phydev, page);
+		if (ret < 0)
+			return ret;
+	}
+
+	return oldpage;
+}
+
+/**
+ * __jlsemi_restore_page() - restore the page register
+ * @phydev: a pointer to a &struct phy_device
+ * @oldpage: the old page, return value from __jlsemi_save_page() or
+ * __jlsemi_select_page()
+ * @ret: operation's return code
+ *
+ * Returns:
+ *   @oldpage if it was a negative value, otherwise
+ *   @ret if it was a negative errno value, otherwise
+ *   phy_write_page()'s negative value if it were in error, otherwise
+ *   @ret
+ */
+static inline int __jlsemi_restore_page(struct phy_device *phydev,
+					int oldpage, int ret)
+{
+	int r;
+
+	if (oldpage >= 0) {
+		r = __jlsemi_write_page(phydev, oldpage);
+
+		/* Propagate the operation return code if the page write
+		 * was successful.
+		 */
+		if (ret >= 0 && r < 0)
+			ret = r;
+	} else {
+		/* Propagate the phy page selection error code */
+		ret = oldpage;
+	}
+
+	return ret;
+}
+
+/**
+ * __jlsemi_modify_reg() - Convenience function for modifying a PHY register
+ * @phydev: a pointer to a &struct phy_device
+ * @regnum: register number
+ * @mask: bit mask of bits to clear
+ * @set: bit mask of bits to set
+ *
+ * Returns negative errno, 0 if there was no change, and 1 in case of change
+ */
+static inline int __jlsemi_modify_reg(struct phy_device *phydev,
+				      u32 regnum, u16 mask, u16 set)
+{
+	struct jl_core_ctrl *core = jlsemi_core_ctrl(phydev);
+	int newval, ret, slot = -1;
+
+	/* Cached registers are keyed by the currently selected page */
+	if (core)
+		slot = jlsemi_reg_cache_slot(phydev, core->page, regnum);
+
+	if (slot >= 0 && (core->regs_valid & BIT(slot)))
+		ret = core->regs[slot];
+	else
+		ret = __jlsemi_read(phydev, regnum);
+	if (ret < 0)
+		return ret;
+
+	if (slot >= 0) {
+		core->regs[slot] = ret;
+		core->regs_valid |= BIT(slot);
+	}
+
+	newval = (ret & ~mask) | set;
+	if (newval == ret)
+		return 0;
+
+	ret = __jlsemi_write(phydev, regnum, newval);
+	if (slot >= 0) {
+		if (ret < 0)
+			core->regs_valid &= ~BIT(slot);
+		else
+			core->regs[slot] = newval;
+	}
+
+	return ret < 0 ? ret : 1;
+}
+
+/**
+ * jlsemi_modify_paged_reg() - Function for modifying a paged register
+ * @phydev: a pointer to a &struct phy_device
+ * @page: the page for the phy
+ * @regnum: register number
+ * @mask: bit mask of bits to clear
+ * @set: bit mask of bits to set
+ *
+ * Returns negative errno, 0 if there was no change, and 1 in case of change
+ */
+int jlsemi_modify_paged_reg(struct phy_device *phydev,
+			    int page, u32 regnum,
+			    u16 mask, u16 set)
+{
+	int ret = 0, oldpage;
 
-	if (priv->fld.enable & JL2XXX_FLD_STATIC_OP_EN) {
-		err = jl2xxx_fld_static_op_set(phydev);
-		if (err < 0)
-			return err;
+	jlsemi_lock_mdio_bus(phydev);
+	if (__jlsemi_cached_noop(phydev, page, regnum, mask, set)) {
+		jlsemi_unlock_mdio_bus(phydev);
+		return 0;
 	}
 
-	if (priv->wol.enable & JL2XXX_WOL_STATIC_OP_EN) {
-		err = jl2xxx_wol_static_op_set(phydev);
-		if (err < 0)
-			return err;
+	oldpage = __jlsemi_select_page(phydev, page);
+	if (oldpage >= 0)
+		ret = __jlsemi_modify_reg(phydev, regnum, mask, set);
+	ret = __jlsemi_restore_page(phydev, oldpage, ret);
+	jlsemi_unlock_mdio_bus(phydev);
+
+	return ret;
+}
+
+/**
+ * jlsemi_set_bits() - Convenience function for setting bits in a PHY register
+ * @phydev: a pointer to a &struct phy_device
+ * @page: the page for the phy
+ * @regnum: register number to write
+ * @val: bits to set
+ */
+int jlsemi_set_bits(struct phy_device *phydev,
+		    int page, u32 regnum, u16 val)
+{
+	return jlsemi_modify_paged_reg(phydev, page, regnum, 0, val);
+}
+
+/**
+ * jlsemi_clear_bits - Convenience function for clearing bits in a PHY register
+ * @phydev: the phy_device struct
+ * @page: the page for the phy
+ * @regnum: register number to write
+ * @val: bits to clear
+ */
+int jlsemi_clear_bits(struct phy_device *phydev,
+		      int page, u32 regnum, u16 val)
+{
+	return jlsemi_modify_paged_reg(phydev, page, regnum, val, 0);
+}
+
+/**
+ * jlsemi_fetch_bit() - Convenience function for setting bits in a PHY register
+ * @phydev: a pointer to a &struct phy_device
+ * @page: the page for the phy
+ * @regnum: register number to write
+ * @val: bit to get
+ *
+ * Note:
+ * you only get one bit at meanwhile
+ *
+ */
+int jlsemi_fetch_bit(struct phy_device *phydev,
+		   int page, u32 regnum, u16 val)
+{
+	int ret = 0, oldpage;
+
+	jlsemi_lock_mdio_bus(phydev);
+	oldpage = __jlsemi_select_page(phydev, page);
+	if (oldpage >= 0) {
+		ret = __jlsemi_read(phydev, regnum);
+		if (ret >= 0)
+			ret = ((ret & val) == val) ? 1 : 0;
 	}
+	ret = __jlsemi_restore_page(phydev, oldpage, ret);
+	jlsemi_unlock_mdio_bus(phydev);
 
-	if (priv->intr.enable & JL2XXX_INTR_STATIC_OP_EN) {
-		err = jl2xxx_intr_static_op_set(phydev);
-		if (err < 0)
-			return err;
+	return ret;
+}
+
+/**
+ * jlsemi_read_paged() - Convenience function for reading a paged register
+ * @phydev: a pointer to a &struct phy_device
+ * @page: the page for the phy
+ * @regnum: register number
+ *
+ * Same rules as for phy_read().
+ */
+int jlsemi_read_paged(struct phy_device *phydev, int page, u32 regnum)
+{
+	int ret = 0, oldpage;
+
+	jlsemi_lock_mdio_bus(phydev);
+	oldpage = __jlsemi_select_page(phydev, page);
+	if (oldpage >= 0)
+		ret = __jlsemi_read(phydev, regnum);
+	ret = __jlsemi_restore_page(phydev, oldpage, ret);
+	jlsemi_unlock_mdio_bus(phydev);
+
+	return ret;
+}
+
+/**
+ * jlsemi_txn_init() - Prepare an empty paged register transaction
+ * @txn: the transaction
+ */
+void jlsemi_txn_init(struct jl_reg_txn *txn)
+{
+	txn->count = 0;
+	txn->err = 0;
+}
+
+/**
+ * jlsemi_txn_modify() - Queue a paged register modification
+ * @txn: the transaction
+ * @page: the page for the phy
+ * @regnum: register number
+ * @mask: bit mask of bits to clear
+ * @set: bit mask of bits to set
+ *
+ * Nothing is sent to the phy until jlsemi_txn_commit(). Updates of the
+ * same register are merged, so the register is read and written once with
+ * the combined result; use separate transactions for write pulses. A full
+ * transaction is remembered and reported by the commit.
+ */
+void jlsemi_txn_modify(struct jl_reg_txn *txn, int page, u32 regnum,
+		       u16 mask, u16 set)
+{
+	struct jl_reg_op *op;
+	int i;
+
+	/* Fold updates of a register already queued into one RMW */
+	for (i = 0; i < txn->count; i++) {
+		op = &txn->ops[i];
+		if (op->page == page && op->reg == regnum) {
+			op->set = (op->set & ~mask) | set;
+			op->mask |= mask;
+			return;
+		}
 	}
 
-	if (priv->downshift.enable & JL2XXX_DSFT_STATIC_OP_EN) {
-		err = jl2xxx_downshift_static_op_set(phydev);
-		if (err < 0)
-			return err;
+	if (txn->count >= JLSEMI_TXN_MAX_OPS) {
+		txn->err = -ENOSPC;
+		return;
 	}
 
-	if (priv->rgmii.enable & JL2XXX_RGMII_STATIC_OP_EN) {
-		err = jl2xxx_rgmii_static_op_set(phydev);
-		if (err < 0)
-			return err;
+	op = &txn->ops[txn->count++];
+	op->page = page;
+	op->reg = regnum;
+	op->mask = mask;
+	op->set = set;
+}
+
+/**
+ * jlsemi_txn_set_bits() - Queue setting bits in a paged register
+ * @txn: the transaction
+ * @page: the page for the phy
+ * @regnum: register number to write
+ * @val: bits to set
+ */
+void jlsemi_txn_set_bits(struct jl_reg_txn *txn,
+			 int page, u32 regnum, u16 val)
+{
+	jlsemi_txn_modify(txn, page, regnum, 0, val);
+}
+
+/**
+ * jlsemi_txn_clear_bits() - Queue clearing bits in a paged register
+ * @txn: the transaction
+ * @page: the page for the phy
+ * @regnum: register number to write
+ * @val: bits to clear
+ */
+void jlsemi_txn_clear_bits(struct jl_reg_txn *txn,
+			   int page, u32 regnum, u16 val)
+{
+	jlsemi_txn_modify(txn, page, regnum, val, 0);
+}
+
+/**
+ * jlsemi_txn_field() - Queue a write of a register field
+ * @txn: the transaction
+ * @field: the field descriptor
+ * @val: field value, unshifted
+ */
+void jlsemi_txn_field(struct jl_reg_txn *txn,
+		      const struct jl_reg_field *field, u16 val)
+{
+	jlsemi_txn_modify(txn, field->page, field->reg, field->mask,
+			  (val << field->shift) & field->mask);
+}
+
+/**
+ * jlsemi_txn_commit() - Run a paged register transaction
+ * @phydev: a pointer to a &struct phy_device
+ * @txn: the transaction
+ *
+ * The operations are grouped by page, keeping their queueing order within
+ * a page, and run under a single mdio bus lock hold. Each page is selected
+ * once and the original page is restored at the end. Operations on
+ * different pages may therefore run out of order: split order sensitive
+ * sequences into separate transactions.
+ *
+ * Returns negative errno or 0 on success.
+ */
+int jlsemi_txn_commit(struct phy_device *phydev, struct jl_reg_txn *txn)
+{
+	struct jl_reg_op *ops = txn->ops;
+	int ret = 0, oldpage;
+	int i, j;
+
+	if (txn->err < 0)
+		return txn->err;
+
+	/* Stable insertion sort, transactions are short */
+	for (i = 1; i < txn->count; i++) {
+		struct jl_reg_op op = ops[i];
+
+		for (j = i; j > 0 && ops[j - 1].page > op.page; j--)
+			ops[j] = ops[j - 1];
+		ops[j] = op;
 	}
 
-	if (priv->clk.enable & JL2XXX_CLK_STATIC_OP_EN) {
-		err = jl2xxx_clk_static_op_set(phydev);
-		if (err < 0)
-			return err;
+	jlsemi_lock_mdio_bus(phydev);
+	oldpage = __jlsemi_save_page(phydev);
+	for (i = 0; oldpage >= 0 && i < txn->count; i++) {
+		if (__jlsemi_cached_noop(phydev, ops[i].page, ops[i].reg,
+					 ops[i].mask, ops[i].set))
+			continue;
+
+		ret = __jlsemi_write_page(phydev, ops[i].page);
+		if (ret < 0)
+			break;
+
+		ret = __jlsemi_modify_reg(phydev, ops[i].reg,
+					  ops[i].mask, ops[i].set);
+		if (ret < 0)
+			break;
+	}
+	ret = __jlsemi_restore_page(phydev, oldpage, ret);
+	jlsemi_unlock_mdio_bus(phydev);
+
+	return ret < 0 ? ret : 0;
+}
+
+/**
+ * jlsemi_script_init() - Prepare an empty register script
+ * @script: the script
+ */
+void jlsemi_script_init(struct jl_reg_script *script)
+{
+	script->count = 0;
+	script->start = 0;
+	script->err = 0;
+}
+
+/**
+ * jlsemi_script_add() - Append the operations of a transaction
+ * @script: the script
+ * @txn: the transaction, not committed
+ *
+ * Updates of a register already in the script since the last barrier are
+ * merged, as jlsemi_txn_modify() does.
+ */
+void jlsemi_script_add(struct jl_reg_script *script,
+		       const struct jl_reg_txn *txn)
+{
+	const struct jl_reg_op *src;
+	struct jl_reg_op *op;
+	int i, j;
+
+	if (txn->err < 0 && !script->err)
+		script->err = txn->err;
+
+	for (i = 0; i < txn->count; i++) {
+		src = &txn->ops[i];
+		for (j = script->start; j < script->count; j++) {
+			op = &script->ops[j];
+			if (op->page == src->page && op->reg == src->reg) {
+				op->set = (op->set & ~src->mask) | src->set;
+				op->mask |= src->mask;
+				break;
+			}
+		}
+		if (j < script->count)
+			continue;
+
+		if (script->count >= JLSEMI_SCRIPT_MAX_OPS) {
+			script->err = -ENOSPC;
+			return;
+		}
+		op = &script->ops[script->count++];
+		*op = *src;
+		op->type = JLSEMI_SCRIPT_OP_MODIFY;
+	}
+}
+
+/* Order the operations since the last barrier by page, stable */
+static void jlsemi_script_close(struct jl_reg_script *script)
+{
+	struct jl_reg_op *ops = script->ops;
+	int i, j;
+
+	for (i = script->start + 1; i < script->count; i++) {
+		struct jl_reg_op op = ops[i];
+
+		for (j = i; j > script->start && ops[j - 1].page > op.page; j--)
+			ops[j] = ops[j - 1];
+		ops[j] = op;
+	}
+	script->start = script->count;
+}
+
+/**
+ * jlsemi_script_barrier() - Append a reset or delay barrier
+ * @script: the script
+ * @type: JLSEMI_SCRIPT_OP_RESET or JLSEMI_SCRIPT_OP_DELAY
+ * @arg: delay in ms for JLSEMI_SCRIPT_OP_DELAY
+ *
+ * Operations are never moved across a barrier.
+ */
+void jlsemi_script_barrier(struct jl_reg_script *script, u8 type, u16 arg)
+{
+	struct jl_reg_op *op;
+
+	jlsemi_script_close(script);
+
+	if (script->count >= JLSEMI_SCRIPT_MAX_OPS) {
+		script->err = -ENOSPC;
+		return;
+	}
+	op = &script->ops[script->count++];
+	op->page = 0;
+	op->reg = 0;
+	op->type = type;
+	op->mask = 0;
+	op->set = arg;
+	script->start = script->count;
+}
+
+/**
+ * jlsemi_script_finish() - Close the script
+ * @script: the script
+ *
+ * Returns negative errno if the script could not be compiled.
+ */
+int jlsemi_script_finish(struct jl_reg_script *script)
+{
+	jlsemi_script_close(script);
+
+	return script->err;
+}
+
+/* Replays the script, or restores the saved values where there are some */
+static int __jlsemi_script_run(struct phy_device *phydev,
+			       const struct jl_reg_script *script,
+			       bool restore, bool force_reset)
+{
+	const struct jl_reg_op *ops = script->ops;
+	bool changed = false;
+	int ret, oldpage;
+	u16 mask, set;
+	int i = 0;
+
+	while (i < script->count) {
+		ret = 0;
+		jlsemi_lock_mdio_bus(phydev);
+		oldpage = __jlsemi_save_page(phydev);
+		for (; oldpage >= 0 && i < script->count; i++) {
+			if (ops[i].type != JLSEMI_SCRIPT_OP_MODIFY)
+				break;
+
+			mask = ops[i].mask;
+			set = ops[i].set;
+			if (restore && (script->saved_valid & BIT(i))) {
+				mask = 0xffff;
+				set = script->saved[i];
+			}
+			if (__jlsemi_cached_noop(phydev, ops[i].page,
+						 ops[i].reg, mask, set))
+				continue;
+
+			ret = __jlsemi_write_page(phydev, ops[i].page);
+			if (ret < 0)
+				break;
+
+			ret = __jlsemi_modify_reg(phydev, ops[i].reg,
+						  mask, set);
+			if (ret < 0)
+				break;
+			if (ret > 0)
+				changed = true;
+		}
+		ret = __jlsemi_restore_page(phydev, oldpage, ret);
+		jlsemi_unlock_mdio_bus(phydev);
+		if (ret < 0)
+			return ret;
+
+		if (i >= script->count)
+			break;
+
+		if (ops[i].type == JLSEMI_SCRIPT_OP_RESET) {
+			if (changed || force_reset) {
+				ret = jlsemi_request_reset(phydev);
+				if (ret < 0)
+					return ret;
+			}
+			changed = false;
+		} else if (ops[i].type == JLSEMI_SCRIPT_OP_DELAY) {
+			msleep(ops[i].set);
+		}
+		i++;
+	}
+
+	return 0;
+}
+
+/**
+ * jlsemi_script_run() - Replay a register script
+ * @phydev: a pointer to a &struct phy_device
+ * @script: the script
+ * @force_reset: request the resets even if nothing was changed
+ *
+ * Each run of operations between barriers is done under a single mdio
+ * bus lock hold, with one page switch per page. A reset barrier goes
+ * through jlsemi_request_reset(), so it is batched by the static init.
+ *
+ * Returns negative errno or 0 on success.
+ */
+int jlsemi_script_run(struct phy_device *phydev,
+		      const struct jl_reg_script *script, bool force_reset)
+{
+	return __jlsemi_script_run(phydev, script, false, force_reset);
+}
+
+/**
+ * jlsemi_script_save() - Snapshot the registers of a script
+ * @phydev: a pointer to a &struct phy_device
+ * @script: the script
+ *
+ * Reads the full value of every register the script writes, except the
+ * volatile ones, so that changes made at runtime (e.g. through ethtool)
+ * survive a restore too.
+ *
+ * Returns negative errno or 0 on success.
+ */
+int jlsemi_script_save(struct phy_device *phydev,
+		       struct jl_reg_script *script)
+{
+	const struct jl_reg_op *ops = script->ops;
+	int ret = 0, oldpage;
+	int i;
+
+	BUILD_BUG_ON(JLSEMI_SCRIPT_MAX_OPS > 32);
+
+	script->saved_valid = 0;
+
+	jlsemi_lock_mdio_bus(phydev);
+	oldpage = __jlsemi_save_page(phydev);
+	for (i = 0; oldpage >= 0 && i < script->count; i++) {
+		if (ops[i].type != JLSEMI_SCRIPT_OP_MODIFY ||
+		    jlsemi_reg_volatile(phydev, ops[i].page, ops[i].reg))
+			continue;
+
+		ret = __jlsemi_write_page(phydev, ops[i].page);
+		if (ret < 0)
+			break;
+
+		ret = __jlsemi_read(phydev, ops[i].reg);
+		if (ret < 0)
+			break;
+
+		script->saved[i] = ret;
+		script->saved_valid |= BIT(i);
 	}
+	ret = __jlsemi_restore_page(phydev, oldpage, ret);
+	jlsemi_unlock_mdio_bus(phydev);
+
+	return ret < 0 ? ret : 0;
+}
+
+/**
+ * jlsemi_script_restore() - Write back the registers saved at suspend
+ * @phydev: a pointer to a &struct phy_device
+ * @script: the script
+ *
+ * Like jlsemi_script_run(), in one pass per barrier, but with the saved
+ * values where there are some. Registers that kept their value are only
+ * read, and a reset is only issued if something had to be written. The
+ * saved values are dropped afterwards, so that a later resume does not
+ * roll back what was changed at runtime since.
+ *
+ * Returns negative errno or 0 on success.
+ */
+int jlsemi_script_restore(struct phy_device *phydev,
+			  struct jl_reg_script *script)
+{
+	int err;
+
+	err = __jlsemi_script_run(phydev, script, true, false);
+
+	jlsemi_lock_mdio_bus(phydev);
+	script->saved_valid = 0;
+	jlsemi_unlock_mdio_bus(phydev);
+
+	return err;
+}
+
+/**
+ * jlsemi_script_update() - Change some bits of a register in the script
+ * @phydev: a pointer to a &struct phy_device
+ * @script: the script
+ * @page: the page of the register
+ * @reg: the register
+ * @mask: the bits to change
+ * @set: their new value
+ *
+ * The entries are patched in place under the mdio bus lock, which the
+ * script users hold while they read them, and the values saved at
+ * suspend are patched alike, so a runtime change survives a re-init or
+ * resume without compiling the script again.
+ */
+void jlsemi_script_update(struct phy_device *phydev,
+			  struct jl_reg_script *script,
+			  u16 page, u8 reg, u16 mask, u16 set)
+{
+	struct jl_reg_op *op;
+	int i;
 
-	if (priv->work_mode.enable & JL2XXX_WORK_MODE_STATIC_OP_EN) {
-		err = jl2xxx_work_mode_static_op_set(phydev);
-		if (err < 0)
-			return err;
+	jlsemi_lock_mdio_bus(phydev);
+	for (i = 0; i < script->count; i++) {
+		op = &script->ops[i];
+		if (op->type != JLSEMI_SCRIPT_OP_MODIFY ||
+		    op->page != page || op->reg != reg)
+			continue;
+
+		op->mask |= mask;
+		op->set = (op->set & ~mask) | (set & mask);
+		if (script->saved_valid & BIT(i))
+			script->saved[i] = (script->saved[i] & ~mask) |
+					   (set & mask);
 	}
+	jlsemi_unlock_mdio_bus(phydev);
+}
 
-	if (priv->lpbk.enable & JL2XXX_LPBK_STATIC_OP_EN) {
-		err = jl2xxx_lpbk_static_op_set(phydev);
-		if (err < 0)
-			return err;
-	}
+static void jlsemi_stats_work(struct work_struct *work);
 
-	if (priv->slew_rate.enable & JL2XXX_SLEW_RATE_STATIC_OP_EN) {
-		err = jl2xxx_slew_rate_static_op_set(phydev);
-		if (err < 0)
-			return err;
-	}
+/**
+ * jlsemi_stats_init() - allocate the statistics of a phy
+ * @stats: statistics control of the phy
+ * @hw: statistics table, keep the entries of a page together
+ * @count: number of entries in @hw
+ *
+ * Return: 0 or negative errno
+ */
+int jlsemi_stats_init(struct jl_stats_ctrl *stats,
+		      const struct jl_hw_stat *hw, int count)
+{
+	int i;
 
-	if (priv->rxc_out.enable & JL2XXX_RXC_OUT_STATIC_OP_EN) {
-		err = jl2xxx_rxc_out_static_op_set(phydev);
-		if (err < 0)
-			return err;
+	stats->hw = hw;
+	stats->count = count;
+	stats->regs = 0;
+	for (i = 0; i < count; i++)
+		if (hw[i].type != JLSEMI_STAT_SOFT)
+			stats->regs++;
+	stats->interval = JLSEMI_STATS_INTERVAL_MS;
+	seqlock_init(&stats->lock);
+	INIT_DELAYED_WORK(&stats->work, jlsemi_stats_work);
+
+	stats->value = kcalloc(count, sizeof(*stats->value), GFP_KERNEL);
+	stats->acc = kcalloc(count, sizeof(*stats->acc), GFP_KERNEL);
+	if (!stats->value || !stats->acc) {
+		jlsemi_stats_free(stats);
+		return -ENOMEM;
 	}
 
 	return 0;
 }
 
-int jl2xxx_pre_init(struct phy_device *phydev, struct jl_patch *patch)
+void jlsemi_stats_free(struct jl_stats_ctrl *stats)
 {
-	bool check;
-
-	check = patch->check(phydev, patch);
-	if (!check)
-		return 0;
-	patch->load(phydev, patch);
-	patch->verify(phydev, patch);
-
-	return 1;
+	jlsemi_stats_stop(stats);
+	kfree(stats->value);
+	kfree(stats->acc);
+	stats->value = NULL;
+	stats->acc = NULL;
 }
 
-int jlsemi_soft_reset(struct phy_device *phydev)
+/**
+ * jlsemi_stats_sweep() - read the statistics registers in one go
+ * @phydev: a pointer to a &struct phy_device
+ * @stats: statistics control of the phy
+ *
+ * Note:
+ * the mdio bus is held for the whole sweep and the page register is
+ * only written when the page changes. Registers that fail to read keep
+ * their last value.
+ */
+static void jlsemi_stats_sweep(struct phy_device *phydev,
+			       struct jl_stats_ctrl *stats)
 {
-	int err;
+	const struct jl_hw_stat *hw;
+	int oldpage;
+	int val;
+	int i;
 
-	err = jlsemi_set_bits(phydev, JL2XXX_PAGE0,
-			      JL2XXX_BMCR_REG, JL2XXX_SOFT_RESET);
-	if (err < 0)
-		return err;
-	/* Wait soft reset complete*/
-	msleep(600);
+	jlsemi_lock_mdio_bus(phydev);
+	oldpage = __jlsemi_save_page(phydev);
+	if (oldpage < 0)
+		goto unlock;
 
-	return 0;
+	for (i = 0; i < stats->count; i++) {
+		hw = &stats->hw[i];
+		if (hw->type == JLSEMI_STAT_SOFT)
+			continue;
+
+		if (__jlsemi_write_page(phydev, hw->page) < 0)
+			continue;
+
+		val = __jlsemi_read(phydev, hw->reg);
+		if (val < 0)
+			continue;
+
+		stats->acc[i] = val & hw->mask;
+	}
+	__jlsemi_restore_page(phydev, oldpage, 0);
+
+unlock:
+	jlsemi_unlock_mdio_bus(phydev);
+
+	write_seqlock(&stats->lock);
+	memcpy(stats->value, stats->acc, stats->count * sizeof(*stats->acc));
+	write_sequnlock(&stats->lock);
 }
 
-/********************** Convenience function for phy **********************/
+static void jlsemi_stats_work(struct work_struct *work)
+{
+	struct jl_stats_ctrl *stats = container_of(to_delayed_work(work),
+						   struct jl_stats_ctrl,
+						   work);
+	int acct;
+
+	acct = jlsemi_acct_begin(stats->phydev, JLSEMI_ACCT_GET_STATS);
+	jlsemi_stats_sweep(stats->phydev, stats);
+	jlsemi_acct_end(stats->phydev, acct);
+
+	schedule_delayed_work(&stats->work,
+			      msecs_to_jiffies(max_t(u32, stats->interval,
+					JLSEMI_STATS_INTERVAL_MIN_MS)));
+}
 
 /**
- * jlsemi_write_page() - write the page register
+ * jlsemi_stats_start() - (re)start harvesting the statistics of a phy
  * @phydev: a pointer to a &struct phy_device
- * @page: page values
+ * @stats: statistics control of the phy
+ *
+ * Note:
+ * used after the phy may have been reset or patched, the registers are
+ * read at once so that ethtool does not report the old values. Nothing
+ * is harvested for a table of driver counted events only.
  */
-int jlsemi_write_page(struct phy_device *phydev, int page)
+void jlsemi_stats_start(struct phy_device *phydev,
+			struct jl_stats_ctrl *stats)
+{
+	jlsemi_stats_stop(stats);
+	if (!stats->regs)
+		return;
+
+	stats->phydev = phydev;
+	jlsemi_stats_sweep(phydev, stats);
+	schedule_delayed_work(&stats->work,
+			      msecs_to_jiffies(max_t(u32, stats->interval,
+					JLSEMI_STATS_INTERVAL_MIN_MS)));
+}
+
+void jlsemi_stats_stop(struct jl_stats_ctrl *stats)
 {
-	return phy_write(phydev, JLSEMI_PAGE31, page);
+	cancel_delayed_work_sync(&stats->work);
 }
 
 /**
- * jlsemi_read_page() - write the page register
- * @phydev: a pointer to a &struct phy_device
- *
- * Return: get page values at present
+ * jlsemi_stats_copy() - copy the last snapshot, without any bus access
+ * @stats: statistics control of the phy
+ * @data: ethtool statistics buffer, stats->count entries
  */
-int jlsemi_read_page(struct phy_device *phydev)
+void jlsemi_stats_copy(struct jl_stats_ctrl *stats, u64 *data)
 {
-	return phy_read(phydev, JLSEMI_PAGE31);
+	unsigned int seq;
+	int i;
+
+	do {
+		seq = read_seqbegin(&stats->lock);
+		for (i = 0; i < stats->count; i++) {
+			if (stats->hw[i].type == JLSEMI_STAT_SOFT)
+				data[i] = stats->soft[stats->hw[i].reg];
+			else
+				data[i] = stats->value[i];
+		}
+	} while (read_seqretry(&stats->lock, seq));
 }
 
 /**
- * __jlsemi_save_page() - save the page value
- *@phydev: a pointer to a &struct phy_device
- *
- * Return: save page value
+ * jlsemi_stats_event() - count an event seen by the driver
+ * @stats: statistics control of the phy
+ * @event: JLSEMI_SOFT_*
  */
-static inline int __jlsemi_save_page(struct phy_device *phydev)
+void jlsemi_stats_event(struct jl_stats_ctrl *stats, int event)
 {
-	return jlsemi_read_page(phydev);
+	write_seqlock(&stats->lock);
+	stats->soft[event]++;
+	write_sequnlock(&stats->lock);
 }
 
 /**
- * __jlsemi_select_page() - restore the page register
+ * jlsemi_stats_link() - count link losses
+ * @stats: statistics control of the phy
+ * @link: link state just read by read_status
+ */
+void jlsemi_stats_link(struct jl_stats_ctrl *stats, int link)
+{
+	if (stats->link && !link)
+		jlsemi_stats_event(stats, JLSEMI_SOFT_LINK_DOWN);
+	stats->link = link;
+}
+
+/**
+ * jlsemi_stats_debugfs_init() - make the harvest interval tunable
  * @phydev: a pointer to a &struct phy_device
- * @page: the page
- *
- * Return:
- * @oldpgae: this is last page value
- * @ret: if page is change it will return new page value
+ * @stats: statistics control of the phy
  */
-static inline int __jlsemi_select_page(struct phy_device *phydev, int page)
+void jlsemi_stats_debugfs_init(struct phy_device *phydev,
+			       struct jl_stats_ctrl *stats)
 {
-	int ret, oldpage;
+	struct jl_core_ctrl *core = jlsemi_core_ctrl(phydev);
 
-	oldpage = ret = __jlsemi_save_page(phydev);
-	if (ret < 0)
-		return ret;
+	debugfs_create_u32("stats_interval", S_IRUGO | S_IWUSR,
+			   core->debugfs, &stats->interval);
+}
 
-	if (oldpage != page) {
-		ret = jlsemi_write_page(phydev, page);
-		if (ret < 0)
-			return ret;
+static struct dentry *jlsemi_debugfs_root;
+static int jlsemi_debugfs_users;
+static DEFINE_MUTEX(jlsemi_debugfs_lock);
+
+static int jlsemi_script_show(struct seq_file *s, void *unused)
+{
+	struct jl_core_ctrl *core = jlsemi_core_ctrl(s->private);
+	const struct jl_reg_op *op;
+	int i;
+
+	seq_puts(s, "page\treg\tmask\tset\n");
+	for (i = 0; i < core->script.count; i++) {
+		op = &core->script.ops[i];
+		if (op->type == JLSEMI_SCRIPT_OP_RESET)
+			seq_puts(s, "reset\n");
+		else if (op->type == JLSEMI_SCRIPT_OP_DELAY)
+			seq_printf(s, "delay\t%u ms\n", op->set);
+		else
+			seq_printf(s, "%u\t%u\t0x%04x\t0x%04x\n", op->page,
+				   op->reg, op->mask, op->set);
 	}
 
-	return oldpage;
+	return 0;
 }
 
-/**
- * __jlsemi_restore_page() - restore the page register
- * @phydev: a pointer to a &struct phy_device
- * @oldpage: the old page, return value from __jlsemi_save_page() or
- * __jlsemi_select_page()
- * @ret: operation's return code
- *
- * Returns:
- *   @oldpage if it was a negative value, otherwise
- *   @ret if it was a negative errno value, otherwise
- *   phy_write_page()'s negative value if it were in error, otherwise
- *   @ret
- */
-static inline int __jlsemi_restore_page(struct phy_device *phydev,
-					int oldpage, int ret)
+static int jlsemi_script_open(struct inode *inode, struct file *file)
 {
-	int r;
+	return single_open(file, jlsemi_script_show, inode->i_private);
+}
 
-	if (oldpage >= 0) {
-		r = jlsemi_write_page(phydev, oldpage);
+static const struct file_operations jlsemi_script_fops = {
+	.owner		= THIS_MODULE,
+	.open		= jlsemi_script_open,
+	.read		= seq_read,
+	.llseek		= seq_lseek,
+	.release	= single_release,
+};
 
-		/* Propagate the operation return code if the page write
-		 * was successful.
-		 */
-		if (ret >= 0 && r < 0)
-			ret = r;
-	} else {
-		/* Propagate the phy page selection error code */
-		ret = oldpage;
-	}
+#if (JLSEMI_MDIO_ACCT)
+static const char * const jlsemi_acct_names[JLSEMI_ACCT_MAX] = {
+	[JLSEMI_ACCT_OTHER]		= "other",
+	[JLSEMI_ACCT_CONFIG_INIT]	= "config_init",
+	[JLSEMI_ACCT_READ_STATUS]	= "read_status",
+	[JLSEMI_ACCT_ANEG_DONE]		= "aneg_done",
+	[JLSEMI_ACCT_GET_STATS]		= "get_stats",
+	[JLSEMI_ACCT_PATCH_LOAD]	= "patch_load",
+};
 
-	return ret;
+static int jlsemi_acct_show(struct seq_file *m, void *v)
+{
+	struct phy_device *phydev = m->private;
+	struct jl_core_ctrl *core = jlsemi_core_ctrl(phydev);
+	struct jl_mdio_acct acct[JLSEMI_ACCT_MAX];
+	int i;
+
+	jlsemi_lock_mdio_bus(phydev);
+	memcpy(acct, core->acct, sizeof(acct));
+	jlsemi_unlock_mdio_bus(phydev);
+
+	seq_printf(m, "%-12s %12s %12s %12s %14s\n",
+		   "op", "reads", "writes", "pages", "ns");
+	for (i = 0; i < JLSEMI_ACCT_MAX; i++)
+		seq_printf(m, "%-12s %12llu %12llu %12llu %14llu\n",
+			   jlsemi_acct_names[i], acct[i].reads,
+			   acct[i].writes, acct[i].pages, acct[i].ns);
+
+	return 0;
 }
 
-/**
- * __jlsemi_modify_reg() - Convenience function for modifying a PHY register
- * @phydev: a pointer to a &struct phy_device
- * @regnum: register number
- * @mask: bit mask of bits to clear
- * @set: bit mask of bits to set
- *
- * Returns negative errno, 0 if there was no change, and 1 in case of change
- */
-static inline int __jlsemi_modify_reg(struct phy_device *phydev,
-				      u32 regnum, u16 mask, u16 set)
+static int jlsemi_acct_open(struct inode *inode, struct file *file)
 {
-	int newval, ret;
+	return single_open(file, jlsemi_acct_show, inode->i_private);
+}
 
-	ret = phy_read(phydev, regnum);
-	if (ret < 0)
-		return ret;
+static const struct file_operations jlsemi_acct_fops = {
+	.owner		= THIS_MODULE,
+	.open		= jlsemi_acct_open,
+	.read		= seq_read,
+	.llseek		= seq_lseek,
+	.release	= single_release,
+};
 
-	newval = (ret & ~mask) | set;
-	if (newval == ret)
-		return 0;
+static int jlsemi_acct_reset(void *data, u64 val)
+{
+	struct phy_device *phydev = data;
+	struct jl_core_ctrl *core = jlsemi_core_ctrl(phydev);
 
-	ret = phy_write(phydev, regnum, newval);
+	jlsemi_lock_mdio_bus(phydev);
+	memset(core->acct, 0, sizeof(core->acct));
+	jlsemi_unlock_mdio_bus(phydev);
 
-	return ret < 0 ? ret : 1;
+	return 0;
 }
 
+DEFINE_SIMPLE_ATTRIBUTE(jlsemi_acct_reset_fops, NULL, jlsemi_acct_reset,
+			"%llu\n");
+#endif
+
 /**
- * jlsemi_modify_paged_reg() - Function for modifying a paged register
+ * jlsemi_debugfs_init() - create the debugfs directory of a phy
  * @phydev: a pointer to a &struct phy_device
- * @page: the page for the phy
- * @regnum: register number
- * @mask: bit mask of bits to clear
- * @set: bit mask of bits to set
  *
- * Returns negative errno, 0 if there was no change, and 1 in case of change
+ * The directory is named after the mdio device under a "jlsemi" root
+ * shared by all phys. Failures are ignored, debugfs is optional.
  */
-int jlsemi_modify_paged_reg(struct phy_device *phydev,
-			    int page, u32 regnum,
-			    u16 mask, u16 set)
+void jlsemi_debugfs_init(struct phy_device *phydev)
 {
-	int ret = 0, oldpage;
+	struct jl_core_ctrl *core = jlsemi_core_ctrl(phydev);
+
+	mutex_lock(&jlsemi_debugfs_lock);
+	if (!jlsemi_debugfs_users++)
+		jlsemi_debugfs_root = debugfs_create_dir("jlsemi", NULL);
+	core->debugfs = debugfs_create_dir(dev_name(jlsemi_get_mdio(phydev)),
+					   jlsemi_debugfs_root);
+	mutex_unlock(&jlsemi_debugfs_lock);
+
+	debugfs_create_file("script", S_IRUGO, core->debugfs, phydev,
+			    &jlsemi_script_fops);
+#if (JLSEMI_MDIO_ACCT)
+	debugfs_create_file("mdio", S_IRUGO, core->debugfs, phydev,
+			    &jlsemi_acct_fops);
+	debugfs_create_file("mdio_reset", S_IWUSR, core->debugfs, phydev,
+			    &jlsemi_acct_reset_fops);
+#endif
+}
 
-	oldpage = __jlsemi_select_page(phydev, page);
-	if (oldpage >= 0)
-		ret = __jlsemi_modify_reg(phydev, regnum, mask, set);
+/**
+ * jlsemi_debugfs_exit() - remove the debugfs directory of a phy
+ * @phydev: a pointer to a &struct phy_device
+ */
+void jlsemi_debugfs_exit(struct phy_device *phydev)
+{
+	struct jl_core_ctrl *core = jlsemi_core_ctrl(phydev);
+
+	mutex_lock(&jlsemi_debugfs_lock);
+	debugfs_remove_recursive(core->debugfs);
+	core->debugfs = NULL;
+	if (!--jlsemi_debugfs_users) {
+		debugfs_remove_recursive(jlsemi_debugfs_root);
+		jlsemi_debugfs_root = NULL;
+	}
+	mutex_unlock(&jlsemi_debugfs_lock);
+}
+
+static int jlsemi_intr_show(struct seq_file *m, void *v)
+{
+	struct jl_intr_ctrl *intr = m->private;
+	struct phy_device *phydev = intr->phydev;
+	const char *mode;
+
+	mutex_lock(&jlsemi_intr_lock);
+	if (intr->storm)
+		mode = "storm";
+	else if (intr->line)
+		mode = "shared";
+	else if (phy_interrupt_is_valid(phydev))
+		mode = "interrupt";
+	else
+		mode = "poll";
+
+	seq_printf(m, "mode: %s\n", mode);
+	seq_printf(m, "events: %llu\n", intr->events);
+	seq_printf(m, "storms: %u\n", intr->storms);
+	seq_printf(m, "window: %u\n", intr->window_events);
+	seq_printf(m, "mask: 0x%04x\n", intr->mask);
+	seq_printf(m, "masked: 0x%04x\n", intr->masked);
+	mutex_unlock(&jlsemi_intr_lock);
+
+	return 0;
+}
+
+static int jlsemi_intr_open(struct inode *inode, struct file *file)
+{
+	return single_open(file, jlsemi_intr_show, inode->i_private);
+}
 
-	return __jlsemi_restore_page(phydev, oldpage, ret);
+static const struct file_operations jlsemi_intr_fops = {
+	.owner		= THIS_MODULE,
+	.open		= jlsemi_intr_open,
+	.read		= seq_read,
+	.llseek		= seq_lseek,
+	.release	= single_release,
+};
+
+static int jlsemi_intr_mask_get(void *data, u64 *val)
+{
+	struct jl_intr_ctrl *intr = data;
+
+	*val = intr->mask;
+
+	return 0;
+}
+
+static int jlsemi_intr_mask_write(void *data, u64 val)
+{
+	if (val > U16_MAX)
+		return -EINVAL;
+
+	return jlsemi_intr_mask_set(data, val);
 }
 
+DEFINE_SIMPLE_ATTRIBUTE(jlsemi_intr_mask_fops, jlsemi_intr_mask_get,
+			jlsemi_intr_mask_write, "0x%04llx\n");
+
 /**
- * jlsemi_set_bits() - Convenience function for setting bits in a PHY register
+ * jlsemi_intr_debugfs_init() - expose the interrupt accounting of a phy
  * @phydev: a pointer to a &struct phy_device
- * @page: the page for the phy
- * @regnum: register number to write
- * @val: bits to set
+ * @intr: interrupt control of the phy
  */
-int jlsemi_set_bits(struct phy_device *phydev,
-		    int page, u32 regnum, u16 val)
+void jlsemi_intr_debugfs_init(struct phy_device *phydev,
+			      struct jl_intr_ctrl *intr)
 {
-	return jlsemi_modify_paged_reg(phydev, page, regnum, 0, val);
+	struct jl_core_ctrl *core = jlsemi_core_ctrl(phydev);
+
+	debugfs_create_file("intr", S_IRUGO, core->debugfs, intr,
+			    &jlsemi_intr_fops);
+	debugfs_create_file("intr_mask", S_IRUGO | S_IWUSR, core->debugfs,
+			    intr, &jlsemi_intr_mask_fops);
 }
 
 /**
- * jlsemi_clear_bits - Convenience function for clearing bits in a PHY register
- * @phydev: the phy_device struct
- * @page: the page for the phy
- * @regnum: register number to write
- * @val: bits to clear
+ * jlsemi_phy_bus() - the mdio bus a phy sits on
+ * @phydev: a pointer to a &struct phy_device
  */
-int jlsemi_clear_bits(struct phy_device *phydev,
-		      int page, u32 regnum, u16 val)
+struct mii_bus *jlsemi_phy_bus(struct phy_device *phydev)
 {
-	return jlsemi_modify_paged_reg(phydev, page, regnum, val, 0);
+	return jlsemi_get_bus(phydev);
 }
 
 /**
- * jlsemi_fetch_bit() - Convenience function for setting bits in a PHY register
- * @phydev: a pointer to a &struct phy_device
- * @page: the page for the phy
- * @regnum: register number to write
- * @val: bit to get
- *
- * Note:
- * you only get one bit at meanwhile
+ * __jlsemi_patch_commit() - hand the last patch word over to the phys
+ * @targets: phys being downloaded, on one mdio bus held by the caller
+ * @count: number of targets
  *
+ * All phys are started before any is polled, so their busy times overlap.
+ * The poll sleeps between reads, the mdio bus lock is a mutex and the
+ * busy time is in the order of tens of microseconds.
  */
-int jlsemi_fetch_bit(struct phy_device *phydev,
-		   int page, u32 regnum, u16 val)
+static void __jlsemi_patch_commit(struct jl_patch_target *targets,
+				  int count)
 {
-	int ret = 0, oldpage;
-
-	oldpage = __jlsemi_select_page(phydev, page);
-	if (oldpage >= 0) {
-		ret = phy_read(phydev, regnum);
+	unsigned long timeout;
+	int ret, i;
+
+	for (i = 0; i < count; i++) {
+		if (targets[i].err < 0)
+			continue;
+		ret = __jlsemi_write(targets[i].phydev, JL2XXX_PATCH_CMD_REG,
+				     JL2XXX_PATCH_CMD_WRITE);
 		if (ret < 0)
-			return ret;
-		ret = ((ret & val) == val) ? 1 : 0;
+			targets[i].err = ret;
 	}
 
-	return __jlsemi_restore_page(phydev, oldpage, ret);
+	timeout = jiffies + msecs_to_jiffies(JL2XXX_PATCH_POLL_TIMEOUT_MS) + 1;
+	for (i = 0; i < count; i++) {
+		while (targets[i].err >= 0) {
+			ret = __jlsemi_read(targets[i].phydev,
+					    JL2XXX_PATCH_CMD_REG);
+			if (ret <= 0) {
+				if (ret < 0)
+					targets[i].err = ret;
+				break;
+			}
+			if (time_after(jiffies, timeout)) {
+				targets[i].err = -ETIMEDOUT;
+				break;
+			}
+			usleep_range(JL2XXX_PATCH_POLL_US,
+				     2 * JL2XXX_PATCH_POLL_US);
+		}
+	}
 }
 
 /**
- * jlsemi_read_paged() - Convenience function for reading a paged register
- * @phydev: a pointer to a &struct phy_device
- * @page: the page for the phy
- * @regnum: register number
+ * jlsemi_download_patch() - write a patch stream to several phys in one go
+ * @targets: phys on one mdio bus, their err is set on return
+ * @count: number of targets
+ * @data: patch stream, see JL2XXX_PATCH_RUN()
+ * @len: number of stream words
  *
- * Same rules as for phy_read().
+ * The mdio bus is held for the whole download instead of being taken
+ * for every word, and each word is written to all targets in turn. A phy
+ * that fails is dropped from the rest of the download.
+ *
+ * Returns negative errno if the stream is bad or the number of register
+ * values written.
  */
-int jlsemi_read_paged(struct phy_device *phydev, int page, u32 regnum)
+int jlsemi_download_patch(struct jl_patch_target *targets, int count,
+			  const u16 *data, int len)
 {
-	int ret = 0, oldpage;
-
-	oldpage = __jlsemi_select_page(phydev, page);
-	if (oldpage >= 0)
-		ret = phy_read(phydev, regnum);
+	const u16 *end = data + len;
+	int words = 0, ret = 0;
+	u32 regaddr;
+	int run, i;
+
+	for (i = 0; i < count; i++)
+		targets[i].err = 0;
+
+	jlsemi_lock_mdio_bus(targets[0].phydev);
+	while (data < end) {
+		regaddr = JL2XXX_PATCH_RUN_REG(*data);
+		run = JL2XXX_PATCH_RUN_LEN(*data++);
+		if (run > end - data) {
+			ret = -EINVAL;
+			break;
+		}
+		for (; run; run--, words++, regaddr++, data++) {
+			for (i = 0; i < count; i++) {
+				if (targets[i].err < 0)
+					continue;
+				ret = __jlsemi_write(targets[i].phydev,
+						     regaddr, *data);
+				if (ret < 0)
+					targets[i].err = ret;
+			}
+			if (regaddr == JL2XXX_PATCH_DATA_LAST_REG)
+				__jlsemi_patch_commit(targets, count);
+		}
+		ret = 0;
+	}
+	/* The patch stream switches pages on its own, drop the shadows
+	 * before anybody else can use the bus
+	 */
+	for (i = 0; i < count; i++)
+		jlsemi_invalidate_cache(targets[i].phydev);
+	jlsemi_unlock_mdio_bus(targets[0].phydev);
 
-	return __jlsemi_restore_page(phydev, oldpage, ret);
+	return ret < 0 ? ret : words;
 }
 
 #if (KERNEL_VERSION(4, 0, 0) > LINUX_VERSION_CODE)
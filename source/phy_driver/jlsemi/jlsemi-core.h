@@ -22,6 +22,10 @@
 #include <linux/kernel.h>
 #include <linux/errno.h>
 #include <linux/of.h>
+#include <linux/workqueue.h>
+#include <linux/completion.h>
+#include <linux/list.h>
+#include <linux/seqlock.h>
 #if (JLSEMI_KERNEL_DEVICE_TREE_USE)
 #include <dt-bindings/phy/jlsemi-dt-phy.h>
 #else
@@ -55,6 +59,7 @@
 #define JL1XXX_WOL_DIS		BIT(15)
 #define JL1XXX_WOL_CLEAR	BIT(1)
 #define JL1xxx_WOL_RECEIVE	BIT(0)
+
 #define ADDR8_HIGH_TO_LOW(n)	((n >> 4) | (n << 4))
 
 #define JL1XXX_PAGE24		24
@@ -76,6 +81,9 @@
 #define JL2XXX_PAGE0		0
 #define JL2XXX_BMCR_REG		0x0000
 #define JL2XXX_SOFT_RESET	BIT(15)
+#define JL2XXX_SOFT_RESET_DELAY_MS	600
+#define JL2XXX_SOFT_RESET_SETTLE_MS	10
+#define JL2XXX_SOFT_RESET_POLL_MS	10
 #define JL2XXX_SPEED_LSB	BIT(13)
 #define JL2XXX_AUTONEG_EN	BIT(12)
 #define JL2XXX_SPEED_MSB	BIT(6)
@@ -94,6 +102,7 @@
 #define JL2XXX_AUTO_GAIN_DIS	BIT(6)
 
 #define JLSEMI_PAGE31		0x001f
+#define JLSEMI_PAGE_UNKNOWN	-1
 #define JL2XXX_WOL_CTRL_PAGE	0x0012
 #define JL2XXX_WOL_CTRL_REG	0x0015
 #define JL2XXX_WOL_STAS_PAGE	0x1200
@@ -115,6 +124,7 @@
 
 #define JL2XXX_PAGE2627		2627
 #define JL2XXX_INTR_STATUS_REG	29
+
 #define JL2XXX_CLK_CTRL_REG	25
 #define JL2XXX_CLK_OUT_PIN	BIT(0)
 #define JL2XXX_CLK_SSC_EN	BIT(3)
@@ -138,6 +148,7 @@
 
 #define JL2XXX_WORK_MODE_REG	21
 #define JL2XXX_WORK_MODE_MASK	0x7
+#define JL2XXX_WORK_MODE_UNKNOWN	(-1)
 
 #define JL2XXX_PAGE160		160
 #define JL2XXX_REG25		25
@@ -182,25 +193,85 @@
 #define ADVERTISE_FIBER_1000FULL	0x20
 
 /*************************************************************************/
+/* Patch stream: runs of a header word (first register << 8 | number
+ * of values) followed by the values for consecutive registers
+ */
+#define JL2XXX_PATCH_RUN(reg, n)	(((reg) << 8) | (n))
+#define JL2XXX_PATCH_RUN_REG(hdr)	((hdr) >> 8)
+#define JL2XXX_PATCH_RUN_LEN(hdr)	((hdr) & 0xff)
+
+/* Writing the last data register of a patch word starts the transfer */
+#define JL2XXX_PATCH_DATA_LAST_REG	0x18
+#define JL2XXX_PATCH_CMD_REG		0x10
+#define JL2XXX_PATCH_CMD_WRITE		0x8006
+#define JL2XXX_PATCH_POLL_TIMEOUT_MS	10
+#define JL2XXX_PATCH_POLL_US		20
+#define JL2XXX_PATCH_SETTLE_MS		20
+
 struct jl_patch {
-	const u32 *data;
+	const u16 *data;
 	u16 data_len;
-	const u16 version;
+	u16 version;
 	struct {
 		const u16 *info;
 		u16 info_len;
 	} phy;
-	bool (*check)(struct phy_device *phydev, struct jl_patch *patch);
+	bool (*check)(struct phy_device *phydev, struct jl_patch *patch,
+		      int mode);
 	int (*load)(struct phy_device *phydev, struct jl_patch *patch);
 	int (*verify)(struct phy_device *phydev, struct jl_patch *patch);
+	bool (*active)(struct phy_device *phydev, struct jl_patch *patch);
 };
 
+/* One phy of a patch download */
+struct jl_patch_target {
+	struct phy_device *phydev;
+	struct jl_patch *patch;		/* The phy's own copy of the patch */
+	int err;			/* First error seen on this phy */
+};
+
+/* Patch firmware container, all fields are little endian */
+#define JL2XXX_PATCH_FW_MAGIC		0x46504c4a	/* "JLPF" */
+#define JL2XXX_PATCH_FW_FORMAT		2
+#define JL2XXX_PATCH_FW_INFO_MAX	4
+#define JL2XXX_PATCH_CHECK_PLAIN	0
+#define JL2XXX_PATCH_CHECK_ZTE		1
+
+struct jl_patch_fw_header {
+	__le32 magic;			/* JL2XXX_PATCH_FW_MAGIC */
+	__le16 format;			/* JL2XXX_PATCH_FW_FORMAT */
+	__le16 count;			/* Number of entries that follow */
+} __packed;
+
+struct jl_patch_fw_entry {
+	__le16 version;			/* Expected patch version, 0 if none */
+	__le16 check;			/* JL2XXX_PATCH_CHECK_* */
+	__le16 info_len;		/* Used entries of info */
+	__le16 info[JL2XXX_PATCH_FW_INFO_MAX];	/* Target fw versions */
+	__le32 data_len;		/* Number of payload words */
+	__le16 data[];			/* Patch stream, as init_data */
+} __packed;
+
+struct jl_patch_index {
+	u16 info;			/* Firmware version */
+	struct jl_patch *patch;		/* Patch for that version */
+};
+
+#define JLSEMI_STAT_INFO	0	/* Register value as read */
+#define JLSEMI_STAT_SOFT	1	/* Event counted by the driver */
+
+/* Events counted by the driver, .reg of a JLSEMI_STAT_SOFT entry */
+#define JLSEMI_SOFT_LINK_DOWN	0	/* Link losses seen by read_status */
+#define JLSEMI_SOFT_WOL		1	/* Wake-on-LAN events */
+#define JLSEMI_SOFT_MAX		2
+
 struct jl_hw_stat {
 	const char *string;
 	u8 reg;
 	u16 page;
 	u16 mask;
 	u16 enable;
+	u8 type;			/* JLSEMI_STAT_* */
 };
 
 static const struct jl_hw_stat jl_phy[] = {
@@ -228,9 +299,39 @@ static const struct jl_hw_stat jl2xxx_hw_stats[] = {
 		.reg	= JL2XXX_PHY_INFO_REG,
 		.page	= JL2XXX_PAGE0,
 		.mask	= JL2XXX_SW_MASK,
+	}, {
+		.string	= "phy_link_down",
+		.reg	= JLSEMI_SOFT_LINK_DOWN,
+		.type	= JLSEMI_STAT_SOFT,
+	},
+};
+
+static const struct jl_hw_stat jl1xxx_hw_stats[] = {
+	{
+		.string	= "phy_link_down",
+		.reg	= JLSEMI_SOFT_LINK_DOWN,
+		.type	= JLSEMI_STAT_SOFT,
+	}, {
+		.string	= "phy_wol_events",
+		.reg	= JLSEMI_SOFT_WOL,
+		.type	= JLSEMI_STAT_SOFT,
 	},
 };
 
+struct jl_stats_ctrl {
+	const struct jl_hw_stat *hw;	/* Statistics table */
+	int count;			/* Entries in hw */
+	int regs;			/* Entries read from the phy */
+	u64 *value;			/* Snapshot reported to ethtool */
+	u64 *acc;			/* Values owned by the harvester */
+	u64 soft[JLSEMI_SOFT_MAX];	/* Events counted by the driver */
+	bool link;			/* Link of the last read_status */
+	seqlock_t lock;			/* Guards value and soft */
+	struct delayed_work work;	/* Harvests the registers */
+	struct phy_device *phydev;	/* Owner, for the harvester */
+	u32 interval;			/* Harvest interval in ms */
+};
+
 struct jl_led_ctrl {
 	u32 enable;			/* LED control enable */
 	u32 mode;			/* LED work mode */
@@ -252,9 +353,39 @@ struct jl_wol_ctrl {
 	bool ethtool;			/* Whether the ethtool is supported */
 };
 
+struct jl_intr_line {
+	struct list_head node;		/* Entry in the line list */
+	struct list_head phys;		/* Phys wired to this line */
+	struct delayed_work work;	/* Ends the coalesce window */
+	unsigned int coalesce;		/* Coalesce window in ms */
+	int irq;			/* Shared interrupt number */
+};
+
 struct jl_intr_ctrl {
 	u32 enable;			/* Interrupt control enable */
+	u32 coalesce;			/* Shared line coalesce window in ms */
 	bool ethtool;			/* Whether the ethtool is supported */
+	struct jl_intr_line *line;	/* Shared line, NULL if not shared */
+	struct list_head node;		/* Entry in line->phys */
+	struct phy_device *phydev;	/* Owner, for the shared line */
+	int page;			/* Status register page */
+	u32 reg;			/* Status register */
+	u16 sources;			/* Sources the phy supports */
+	u16 mask;			/* Enabled event sources */
+	u16 link;			/* Events phylib has to look at */
+	bool pending;			/* Link event inside the window */
+	int ctrl_page;			/* Control register page */
+	u32 ctrl_reg;			/* Control register */
+	u64 events;			/* Interrupts taken */
+	u32 storms;			/* Storms detected */
+	unsigned long window_start;	/* Start of the rate window */
+	u32 window_events;		/* Interrupts in the rate window */
+	u16 window_seen;		/* Sources seen in the rate window */
+	bool storm;			/* Sources masked, phy polled */
+	u16 masked;			/* Sources masked by the storm */
+	int backoff;			/* Storms in a row */
+	unsigned long quiet_end;	/* End of the quiet period */
+	struct delayed_work storm_work;	/* Polls the phy during a storm */
 };
 
 struct jl_downshift_ctrl {
@@ -270,9 +401,29 @@ struct jl_rgmii_ctrl {
 	bool ethtool;			/* Whether the ethtool is supported */
 };
 
+/* The jl2xxx phys with a patch on one mdio bus */
+struct jl_patch_bus {
+	struct list_head node;		/* Entry in the bus list */
+	struct list_head phys;		/* Phys with a patch on this bus */
+	struct mutex lock;		/* Serializes the downloads on the bus */
+	struct mii_bus *bus;		/* The mdio bus */
+};
+
 struct jl_patch_ctrl {
 	u32 enable;			/* Patch control enable */
 	bool ethtool;			/* Whether the ethtool is supported */
+	struct completion fw_done;	/* Firmware request has finished */
+	struct jl_patch *fw_patches;	/* Patches parsed from firmware */
+	int fw_count;			/* Number of fw_patches */
+	struct jl_patch_index *index;	/* Patches sorted by fw version */
+	int index_len;			/* Number of index entries */
+	struct jl_patch *selected;	/* Found by the last patch_find */
+	struct jl_patch *loaded;	/* Last patch downloaded */
+	int load_words;			/* Words written by the last download */
+	unsigned int load_ms;		/* Time taken by the last download */
+	struct list_head node;		/* Entry in the patch group list */
+	struct jl_patch_bus *bus;	/* Patch group of the mdio bus */
+	struct phy_device *phydev;	/* Owner, for the patch group */
 };
 
 struct jl_clk_ctrl {
@@ -283,6 +434,7 @@ struct jl_clk_ctrl {
 struct jl_work_mode_ctrl {
 	u32 enable;			/* Work mode control enable */
 	u32 mode;			/* Work mode select mode */
+	int cur;			/* Work mode the phy runs in, cached */
 	bool ethtool;			/* Whether the ethtool is supported */
 };
 
@@ -317,16 +469,112 @@ struct jl_rxc_out_ctrl {
 	bool ethtool;			/* Whether the ethtool is supported */
 };
 
+struct jl_async_init_ctrl {
+	u32 enable;			/* Asynchronous init control enable */
+	struct work_struct work;	/* Runs the static operations */
+	struct phy_device *phydev;	/* Back pointer for the work */
+	atomic_t pending;		/* Init requests not served yet */
+	int err;			/* Result of the static operations */
+	bool aneg;			/* Autoneg held off until served */
+	bool ethtool;			/* Whether the ethtool is supported */
+};
+
+#define JLSEMI_REG_CACHE_MAX	8
+#define JLSEMI_TXN_MAX_OPS	16
+#define JLSEMI_SCRIPT_MAX_OPS	32
+
+/* Register script entry types */
+#define JLSEMI_SCRIPT_OP_MODIFY	0	/* Paged read-modify-write */
+#define JLSEMI_SCRIPT_OP_RESET	1	/* Soft reset barrier */
+#define JLSEMI_SCRIPT_OP_DELAY	2	/* Sleep barrier, set is in ms */
+
+struct jl_reg_key {
+	u16 page;			/* Register page */
+	u8 reg;				/* Register number */
+};
+
+struct jl_reg_op {
+	u16 page;			/* Register page */
+	u8 reg;				/* Register number */
+	u8 type;			/* JLSEMI_SCRIPT_OP_* */
+	u16 mask;			/* Bits to clear */
+	u16 set;			/* Bits to set */
+};
+
+struct jl_reg_txn {
+	struct jl_reg_op ops[JLSEMI_TXN_MAX_OPS];
+	int count;			/* Number of queued operations */
+	int err;			/* First error seen while queueing */
+};
+
+/* The static configuration, compiled once at probe */
+struct jl_reg_script {
+	struct jl_reg_op ops[JLSEMI_SCRIPT_MAX_OPS];
+	int count;			/* Number of entries */
+	int start;			/* First entry after the last barrier */
+	int err;			/* First error seen while compiling */
+	u16 saved[JLSEMI_SCRIPT_MAX_OPS];	/* Values at suspend */
+	u32 saved_valid;		/* Valid bitmap of saved */
+};
+
+struct jl_reg_field {
+	u16 page;			/* Register page */
+	u8 reg;				/* Register number */
+	u16 mask;			/* Field mask in the register */
+	u8 shift;			/* Field position in the register */
+};
+
+#define JLSEMI_REG_FIELD(_page, _reg, _mask, _shift)			\
+	{ .page = _page, .reg = _reg, .mask = _mask, .shift = _shift }
+
+/* Operations the mdio accounting is broken down by */
+#define JLSEMI_ACCT_OTHER	0
+#define JLSEMI_ACCT_CONFIG_INIT	1
+#define JLSEMI_ACCT_READ_STATUS	2
+#define JLSEMI_ACCT_ANEG_DONE	3
+#define JLSEMI_ACCT_GET_STATS	4
+#define JLSEMI_ACCT_PATCH_LOAD	5
+#define JLSEMI_ACCT_MAX		6
+
+/* jlsemi_acct_begin() results that do not name an operation */
+#define JLSEMI_ACCT_BUSY	-1	/* Another task owns the phy */
+#define JLSEMI_ACCT_IDLE	-2	/* Nothing was being accounted */
+
+struct jl_mdio_acct {
+	u64 reads;			/* Register reads */
+	u64 writes;			/* Register writes, pages included */
+	u64 pages;			/* Page register writes */
+	u64 ns;				/* Time spent on the bus */
+};
+
+struct jl_core_ctrl {
+	int page;			/* Shadow of the page register */
+	u16 regs[JLSEMI_REG_CACHE_MAX];	/* Write-through register cache */
+	u32 regs_valid;			/* Valid bitmap of regs */
+	bool reset_defer;		/* Soft resets are being batched */
+	bool reset_pending;		/* A batched soft reset is owed */
+	struct jl_reg_script script;	/* Compiled static configuration */
+	struct dentry *debugfs;		/* Per phy debugfs directory */
+#if (JLSEMI_MDIO_ACCT)
+	struct jl_mdio_acct acct[JLSEMI_ACCT_MAX];
+	struct task_struct *acct_task;	/* Task running acct_op */
+	int acct_op;			/* Operation being accounted */
+#endif
+};
+
 struct jl1xxx_priv {
+	struct jl_core_ctrl core;
 	struct jl_led_ctrl led;
 	struct jl_wol_ctrl wol;
 	struct jl_intr_ctrl intr;
 	bool static_inited;		/* Initialization flag */
 	struct jl_mdi_ctrl mdi;
 	struct jl_rmii_ctrl rmii;
+	struct jl_stats_ctrl stats;
 };
 
 struct jl2xxx_priv {
+	struct jl_core_ctrl core;
 	struct jl_led_ctrl led;
 	struct jl_fld_ctrl fld;
 	struct jl_wol_ctrl wol;
@@ -335,14 +583,13 @@ struct jl2xxx_priv {
 	struct jl_rgmii_ctrl rgmii;
 	struct jl_patch_ctrl patch;
 	struct jl_clk_ctrl clk;
-	const struct jl_hw_stat *hw_stats;
 	bool static_inited;		/* Initialization flag */
-	int nstats;			/* Record for dynamic operation */
-	u64 *stats;			/* Pointer for dynamic operation */
+	struct jl_stats_ctrl stats;
 	struct jl_work_mode_ctrl work_mode;
 	struct jl_loopback_ctrl lpbk;
 	struct jl_slew_rate_ctrl slew_rate;
 	struct jl_rxc_out_ctrl rxc_out;
+	struct jl_async_init_ctrl async_init;
 };
 
 /* macros to simplify debug checking */
@@ -361,10 +608,37 @@ int jl2xxx_intr_ack_event(struct phy_device *phydev);
 
 int jl2xxx_intr_static_op_set(struct phy_device *phydev);
 
+u16 jl2xxx_intr_mask(struct phy_device *phydev);
+
+int jl2xxx_intr_disable(struct phy_device *phydev);
+
 int jl1xxx_intr_ack_event(struct phy_device *phydev);
 
 int jl1xxx_intr_static_op_set(struct phy_device *phydev);
 
+u16 jl1xxx_intr_mask(struct phy_device *phydev);
+
+int jl1xxx_intr_disable(struct phy_device *phydev);
+
+void jlsemi_irq_setup(struct phy_device *phydev, bool enable, int irq);
+
+int jl1xxx_intr_line_attach(struct phy_device *phydev);
+
+int jl2xxx_intr_line_attach(struct phy_device *phydev);
+
+void jlsemi_intr_line_detach(struct jl_intr_ctrl *intr);
+
+bool jlsemi_intr_account(struct jl_intr_ctrl *intr, int status);
+
+void jlsemi_intr_storm_cancel(struct jl_intr_ctrl *intr);
+
+void jlsemi_intr_storm_stop(struct jl_intr_ctrl *intr, bool unmask);
+
+int jlsemi_intr_mask_set(struct jl_intr_ctrl *intr, u16 mask);
+
+void jlsemi_intr_debugfs_init(struct phy_device *phydev,
+			      struct jl_intr_ctrl *intr);
+
 int jl2xxx_wol_dynamic_op_get(struct phy_device *phydev);
 
 int jl2xxx_wol_dynamic_op_set(struct phy_device *phydev);
@@ -373,21 +647,56 @@ int jl1xxx_wol_dynamic_op_get(struct phy_device *phydev);
 
 int jl1xxx_wol_dynamic_op_set(struct phy_device *phydev);
 
+int jl1xxx_wol_event_clear(struct phy_device *phydev);
+
 int jl2xxx_fld_dynamic_op_get(struct phy_device *phydev, u8 *msecs);
 
 int jl2xxx_fld_dynamic_op_set(struct phy_device *phydev, const u8 *msecs);
 
 int jl1xxx_operation_args_get(struct phy_device *phydev);
 
+int jl1xxx_script_compile(struct phy_device *phydev);
+
 int jl1xxx_static_op_init(struct phy_device *phydev);
 
 int jl2xxx_operation_args_get(struct phy_device *phydev);
 
+int jl2xxx_script_compile(struct phy_device *phydev);
+
 int jl2xxx_static_op_init(struct phy_device *phydev);
 
+int jl2xxx_async_init_start(struct phy_device *phydev);
+
+int jl2xxx_async_init_status(struct phy_device *phydev);
+
+void jl2xxx_async_init_flush(struct phy_device *phydev);
+
+void jl2xxx_async_init_cancel(struct phy_device *phydev);
+
 int jlsemi_soft_reset(struct phy_device *phydev);
 
-int jl2xxx_pre_init(struct phy_device *phydev, struct jl_patch *patch);
+int jlsemi_request_reset(struct phy_device *phydev);
+
+void jlsemi_defer_reset(struct phy_device *phydev);
+
+int jlsemi_reset_barrier(struct phy_device *phydev);
+
+int jlsemi_flush_reset(struct phy_device *phydev);
+
+int jl2xxx_work_mode_get(struct phy_device *phydev);
+
+void jl2xxx_work_mode_forget(struct phy_device *phydev);
+
+int jl2xxx_pre_init(struct phy_device *phydev, struct jl_patch *patch,
+		    int mode);
+
+int jl2xxx_patch_fw_request(struct phy_device *phydev);
+
+void jl2xxx_patch_release(struct phy_device *phydev);
+
+void jl2xxx_patch_forget(struct phy_device *phydev);
+
+int jl2xxx_patch_lost(struct phy_device *phydev);
 
 bool jl2xxx_read_fiber_status(struct phy_device *phydev);
 
@@ -400,6 +709,8 @@ int jlsemi_write_page(struct phy_device *phydev, int page);
 
 int jlsemi_read_page(struct phy_device *phydev);
 
+void jlsemi_invalidate_cache(struct phy_device *phydev);
+
 int jlsemi_modify_paged_reg(struct phy_device *phydev,
 			    int page, u32 regnum,
 			    u16 mask, u16 set);
@@ -413,6 +724,89 @@ int jlsemi_clear_bits(struct phy_device *phydev,
 int jlsemi_fetch_bit(struct phy_device *phydev,
 		     int page, u32 regnum, u16 val);
 
+void jlsemi_txn_init(struct jl_reg_txn *txn);
+
+void jlsemi_txn_modify(struct jl_reg_txn *txn, int page, u32 regnum,
+		       u16 mask, u16 set);
+
+void jlsemi_txn_set_bits(struct jl_reg_txn *txn,
+			 int page, u32 regnum, u16 val);
+
+void jlsemi_txn_clear_bits(struct jl_reg_txn *txn,
+			   int page, u32 regnum, u16 val);
+
+void jlsemi_txn_field(struct jl_reg_txn *txn,
+		      const struct jl_reg_field *field, u16 val);
+
+int jlsemi_txn_commit(struct phy_device *phydev, struct jl_reg_txn *txn);
+
+void jlsemi_script_init(struct jl_reg_script *script);
+
+void jlsemi_script_add(struct jl_reg_script *script,
+		       const struct jl_reg_txn *txn);
+
+void jlsemi_script_barrier(struct jl_reg_script *script, u8 type, u16 arg);
+
+int jlsemi_script_finish(struct jl_reg_script *script);
+
+int jlsemi_script_run(struct phy_device *phydev,
+		      const struct jl_reg_script *script, bool force_reset);
+
+int jlsemi_script_save(struct phy_device *phydev,
+		       struct jl_reg_script *script);
+
+int jlsemi_stats_init(struct jl_stats_ctrl *stats,
+		      const struct jl_hw_stat *hw, int count);
+
+void jlsemi_stats_free(struct jl_stats_ctrl *stats);
+
+void jlsemi_stats_start(struct phy_device *phydev,
+			struct jl_stats_ctrl *stats);
+
+void jlsemi_stats_stop(struct jl_stats_ctrl *stats);
+
+void jlsemi_stats_copy(struct jl_stats_ctrl *stats, u64 *data);
+
+#if (JLSEMI_MDIO_ACCT)
+int jlsemi_acct_begin(struct phy_device *phydev, int op);
+
+void jlsemi_acct_end(struct phy_device *phydev, int prev);
+#else
+static inline int jlsemi_acct_begin(struct phy_device *phydev, int op)
+{
+	return JLSEMI_ACCT_IDLE;
+}
+
+static inline void jlsemi_acct_end(struct phy_device *phydev, int prev)
+{
+}
+#endif
+
+int jlsemi_read(struct phy_device *phydev, u32 regnum);
+
+void jlsemi_stats_debugfs_init(struct phy_device *phydev,
+			       struct jl_stats_ctrl *stats);
+
+void jlsemi_stats_event(struct jl_stats_ctrl *stats, int event);
+
+void jlsemi_stats_link(struct jl_stats_ctrl *stats, int link);
+
+int jlsemi_script_restore(struct phy_device *phydev,
+			  struct jl_reg_script *script);
+
+void jlsemi_script_update(struct phy_device *phydev,
+			  struct jl_reg_script *script,
+			  u16 page, u8 reg, u16 mask, u16 set);
+
+void jlsemi_debugfs_init(struct phy_device *phydev);
+
+void jlsemi_debugfs_exit(struct phy_device *phydev);
+
+struct mii_bus *jlsemi_phy_bus(struct phy_device *phydev);
+
+int jlsemi_download_patch(struct jl_patch_target *targets, int count,
+			  const u16 *data, int len);
+
 int jlsemi_drivers_register(struct phy_driver *phydrvs, int size);
 
 void jlsemi_drivers_unregister(struct phy_driver *phydrvs, int size);
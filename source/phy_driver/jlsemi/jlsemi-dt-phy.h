@@ -14,8 +14,18 @@
 #define JLSEMI_DEV_COMPATIBLE	(KERNEL_VERSION(4, 5, 0) > LINUX_VERSION_CODE)
 #define JL2XXX_GET_STRING	(KERNEL_VERSION(4, 5, 0) <= LINUX_VERSION_CODE)
 #define JL2XXX_GET_STAT		(KERNEL_VERSION(4, 5, 0) <= LINUX_VERSION_CODE)
+#define JL1XXX_GET_STRING	(KERNEL_VERSION(4, 5, 0) <= LINUX_VERSION_CODE)
+#define JL1XXX_GET_STAT		(KERNEL_VERSION(4, 5, 0) <= LINUX_VERSION_CODE)
 #define JL2XXX_PHY_TUNABLE	(KERNEL_VERSION(5, 0, 0) <= LINUX_VERSION_CODE)
 #define JLSEMI_PHY_WOL		(KERNEL_VERSION(3, 10, 0) < LINUX_VERSION_CODE)
+#define JLSEMI_PHY_UNLOCKED_ACCESS	\
+	(KERNEL_VERSION(4, 16, 0) <= LINUX_VERSION_CODE)
+#define JLSEMI_PHY_HANDLE_INTR	\
+	(KERNEL_VERSION(5, 11, 0) <= LINUX_VERSION_CODE)
+#define JLSEMI_PHY_MAC_INTR_LINK	\
+	(KERNEL_VERSION(4, 16, 0) > LINUX_VERSION_CODE)
+#define JLSEMI_PHY_TRACE_ENABLED	\
+	(KERNEL_VERSION(4, 4, 0) <= LINUX_VERSION_CODE)
 /*************************************************************************/
 
 /**************************** JLSemi Debug *******************************/
@@ -26,6 +36,60 @@
 #define JLSEMI_PHY_NOT_REENTRANT	false
 /*************************************************************************/
 
+/************************ JLSemi Interrupt Storm *************************/
+/* More than STORM_EVENTS interrupts of one phy within STORM_WINDOW_MS
+ * mask the sources seen in that window and poll the phy every
+ * STORM_POLL_MS. The sources come back after STORM_QUIET_MS, doubled
+ * for each storm in a row up to STORM_BACKOFF_MAX times.
+ */
+#define JLSEMI_INTR_STORM_EVENTS	64
+#define JLSEMI_INTR_STORM_WINDOW_MS	1000
+#define JLSEMI_INTR_STORM_POLL_MS	1000
+#define JLSEMI_INTR_STORM_QUIET_MS	10000
+#define JLSEMI_INTR_STORM_BACKOFF_MAX	4
+/*************************************************************************/
+
+/************************ JLSemi Statistics ******************************/
+/* The registers are harvested in the background every STATS_INTERVAL_MS
+ * (runtime tunable through debugfs), ethtool -S only copies the last
+ * snapshot.
+ */
+#define JLSEMI_STATS_INTERVAL_MS	1000
+#define JLSEMI_STATS_INTERVAL_MIN_MS	100
+/*************************************************************************/
+
+/************************ JLSemi MDIO Accounting *************************/
+/* Count the mdio cycles issued by the driver and the time they take,
+ * per phy and per operation, in debugfs. Compiles to nothing if false.
+ */
+#define JLSEMI_MDIO_ACCT		false
+/*************************************************************************/
+
+/************************* JLSemi Page Cache *****************************/
+/* Track the selected page in the driver instead of reading register 31
+ * before every paged access. Set it to false when another agent (e.g.
+ * mdio-tool) switches pages while the driver is running.
+ */
+#define JLSEMI_PAGE_CACHE_EN		true
+/*************************************************************************/
+
+/************************ JLSemi Register Cache **************************/
+/* Keep a write-through copy of static configuration registers (LED,
+ * RGMII delay, clock output, ...) so that read-modify-write cycles on
+ * them do not have to read the phy. Set it to false for the same reason
+ * as above.
+ */
+#define JLSEMI_REG_CACHE_EN		true
+/*************************************************************************/
+
+/************************* JLSemi Soft Reset *****************************/
+/* Poll BMCR until the reset bit self-clears instead of always sleeping
+ * for the worst case. Set it to false for silicon revisions that need
+ * the fixed delay.
+ */
+#define JLSEMI_SOFT_RESET_POLL		true
+/*************************************************************************/
+
 /**************************** JL1XXX-LED *********************************/
 /* PHY LED Modes Select */
 #define JL1XXX_LED0_STRAP		(1 << 0)
@@ -90,12 +154,18 @@
 #define JL1XXX_INTR_STATIC_OP_EN	(1 << 0)
 #define JL1XXX_INTR_LINK_CHANGE_EN	(1 << 1)
 #define JL1XXX_INTR_AN_ERR_EN		(1 << 2)
+#define JL1XXX_INTR_SHARED_EN		(1 << 3)
 //-----------------------------------------------------------------------//
-/* PHY Interrupt Irq Number Config */
+/* PHY Interrupt Irq Number Config, only used when the phy node
+ * has no "interrupts" property
+ */
 #define JL1XXX_INTR_IRQ			-1
 
 /* PHY Interrupt Control Enable Mask Config */
 #define JL1XXX_INTR_CTRL_EN	(0)
+
+/* PHY Interrupt Shared Line Coalesce Window(ms) Config */
+#define JL1XXX_INTR_COALESCE_MS		0
 /*************************************************************************/
 
 /**************************** JL1XXX-MDI *********************************/
@@ -227,12 +297,18 @@
 #define JL2XXX_INTR_AN_ERR_EN		(1 << 2)
 #define JL2XXX_INTR_AN_COMPLETE_EN	(1 << 3)
 #define JL2XXX_INTR_AN_PAGE_RECE	(1 << 4)
+#define JL2XXX_INTR_SHARED_EN		(1 << 5)
 //-----------------------------------------------------------------------//
-/* PHY Interrupt Irq Number Config */
+/* PHY Interrupt Irq Number Config, only used when the phy node
+ * has no "interrupts" property
+ */
 #define JL2XXX_INTR_IRQ			-1
 
 /* PHY Interrupt Control Enable Mask Config */
 #define JL2XXX_INTR_CTRL_EN	(0)
+
+/* PHY Interrupt Shared Line Coalesce Window(ms) Config */
+#define JL2XXX_INTR_COALESCE_MS		0
 /*************************************************************************/
 
 /**************************** JL2XXX-DSFT ********************************/
@@ -267,6 +343,20 @@
 /* PHY Patch Control Mode Enable Mask Config */
 #define JL2XXX_PATCH_CTRL_EN	(JL2XXX_PATCH_STATIC_OP_EN)
 
+/* PHY Patch Source Config, the firmware file is tried first and the
+ * built-in tables are only used when it can not be loaded, or has not
+ * been loaded within JL2XXX_PATCH_FW_WAIT_MS
+ */
+#define JL2XXX_PATCH_FIRMWARE		true
+#define JL2XXX_PATCH_FW_NAME		"jlsemi/jl2xxx-patch.bin"
+#define JL2XXX_PATCH_FW_WAIT_MS		2000
+#define JL2XXX_PATCH_BUILTIN		true
+
+/* PHY Patch Group Config, identical phys on one mdio bus are
+ * downloaded together
+ */
+#define JL2XXX_PATCH_GROUP		true
+
 /*************************************************************************/
 
 /**************************** JL2XXX-CLOCK *******************************/
@@ -337,5 +427,14 @@
 /* PHY Rx Clock Out Control Mode Enable Mask Config */
 #define JL2XXX_RXC_OUT_CTRL_EN		(0)
 
+/*************************************************************************/
+
+/**************************** JL2XXX-ASYNC_INIT **************************/
+/* PHY Asynchronous Init Control Mode Enable Mask Select */
+#define JL2XXX_ASYNC_INIT_STATIC_OP_EN	(1 << 0)
+//-----------------------------------------------------------------------//
+/* PHY Asynchronous Init Control Mode Enable Mask Config */
+#define JL2XXX_ASYNC_INIT_CTRL_EN	(0)
+
 /*************************************************************************/
 #endif
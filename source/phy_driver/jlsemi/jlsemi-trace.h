@@ -0,0 +1,207 @@
+/* SPDX-License-Identifier: GPL-2.0+
+ *
+ * Copyright (C) 2021 JLSemi Corporation
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation version 2.
+ *
+ * This program is distributed "as is" WITHOUT ANY WARRANTY of any
+ * kind, whether express or implied; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ */
+#undef TRACE_SYSTEM
+#define TRACE_SYSTEM jlsemi
+
+#if !defined(_JLSEMI_TRACE_H) || defined(TRACE_HEADER_MULTI_READ)
+#define _JLSEMI_TRACE_H
+
+#include <linux/tracepoint.h>
+#include <linux/ktime.h>
+
+/* @start is the ktime in ns the bus cycle was issued at, the duration is
+ * only worked out when the event is enabled
+ */
+DECLARE_EVENT_CLASS(jlsemi_mdio,
+
+	TP_PROTO(const char *dev, int page, u32 regnum, int val, u64 start),
+
+	TP_ARGS(dev, page, regnum, val, start),
+
+	TP_STRUCT__entry(
+		__string(dev, dev)
+		__field(int, page)
+		__field(u32, regnum)
+		__field(int, val)
+		__field(u64, ns)
+	),
+
+	TP_fast_assign(
+		__assign_str(dev, dev);
+		__entry->page = page;
+		__entry->regnum = regnum;
+		__entry->val = val;
+		__entry->ns = ktime_to_ns(ktime_get()) - start;
+	),
+
+	TP_printk("%s page=%d reg=%u val=0x%04x ns=%llu",
+		  __get_str(dev), __entry->page, __entry->regnum,
+		  __entry->val, __entry->ns)
+);
+
+DEFINE_EVENT(jlsemi_mdio, jlsemi_read,
+
+	TP_PROTO(const char *dev, int page, u32 regnum, int val, u64 start),
+
+	TP_ARGS(dev, page, regnum, val, start)
+);
+
+DEFINE_EVENT(jlsemi_mdio, jlsemi_write,
+
+	TP_PROTO(const char *dev, int page, u32 regnum, int val, u64 start),
+
+	TP_ARGS(dev, page, regnum, val, start)
+);
+
+TRACE_EVENT(jlsemi_soft_reset,
+
+	TP_PROTO(const char *dev, int err, unsigned int ms),
+
+	TP_ARGS(dev, err, ms),
+
+	TP_STRUCT__entry(
+		__string(dev, dev)
+		__field(int, err)
+		__field(unsigned int, ms)
+	),
+
+	TP_fast_assign(
+		__assign_str(dev, dev);
+		__entry->err = err;
+		__entry->ms = ms;
+	),
+
+	TP_printk("%s err=%d ms=%u", __get_str(dev), __entry->err, __entry->ms)
+);
+
+TRACE_EVENT(jlsemi_patch_load_start,
+
+	TP_PROTO(const char *dev, int phys, u32 len),
+
+	TP_ARGS(dev, phys, len),
+
+	TP_STRUCT__entry(
+		__string(dev, dev)
+		__field(int, phys)
+		__field(u32, len)
+	),
+
+	TP_fast_assign(
+		__assign_str(dev, dev);
+		__entry->phys = phys;
+		__entry->len = len;
+	),
+
+	TP_printk("%s phys=%d len=%u", __get_str(dev), __entry->phys,
+		  __entry->len)
+);
+
+TRACE_EVENT(jlsemi_patch_load_end,
+
+	TP_PROTO(const char *dev, int words, unsigned int ms),
+
+	TP_ARGS(dev, words, ms),
+
+	TP_STRUCT__entry(
+		__string(dev, dev)
+		__field(int, words)
+		__field(unsigned int, ms)
+	),
+
+	TP_fast_assign(
+		__assign_str(dev, dev);
+		__entry->words = words;
+		__entry->ms = ms;
+	),
+
+	TP_printk("%s words=%d ms=%u", __get_str(dev), __entry->words,
+		  __entry->ms)
+);
+
+TRACE_EVENT(jlsemi_patch_verify,
+
+	TP_PROTO(const char *dev, int expect, int val),
+
+	TP_ARGS(dev, expect, val),
+
+	TP_STRUCT__entry(
+		__string(dev, dev)
+		__field(int, expect)
+		__field(int, val)
+	),
+
+	TP_fast_assign(
+		__assign_str(dev, dev);
+		__entry->expect = expect;
+		__entry->val = val;
+	),
+
+	TP_printk("%s expect=0x%04x val=0x%04x %s", __get_str(dev),
+		  __entry->expect, __entry->val,
+		  __entry->expect == __entry->val ? "ok" : "mismatch")
+);
+
+TRACE_EVENT(jlsemi_intr_ack,
+
+	TP_PROTO(const char *dev, int status),
+
+	TP_ARGS(dev, status),
+
+	TP_STRUCT__entry(
+		__string(dev, dev)
+		__field(int, status)
+	),
+
+	TP_fast_assign(
+		__assign_str(dev, dev);
+		__entry->status = status;
+	),
+
+	TP_printk("%s status=0x%04x", __get_str(dev), __entry->status)
+);
+
+TRACE_EVENT(jlsemi_media,
+
+	TP_PROTO(const char *dev, int mode, int interface, bool fiber),
+
+	TP_ARGS(dev, mode, interface, fiber),
+
+	TP_STRUCT__entry(
+		__string(dev, dev)
+		__field(int, mode)
+		__field(int, interface)
+		__field(bool, fiber)
+	),
+
+	TP_fast_assign(
+		__assign_str(dev, dev);
+		__entry->mode = mode;
+		__entry->interface = interface;
+		__entry->fiber = fiber;
+	),
+
+	TP_printk("%s mode=%d interface=%d media=%s", __get_str(dev),
+		  __entry->mode, __entry->interface,
+		  __entry->fiber ? "fiber" : "utp")
+);
+
+#endif /* _JLSEMI_TRACE_H */
+
+/* This part must be outside protection */
+#undef TRACE_INCLUDE_PATH
+#define TRACE_INCLUDE_PATH .
+#undef TRACE_INCLUDE_FILE
+#define TRACE_INCLUDE_FILE jlsemi-trace
+#include <trace/define_trace.h>
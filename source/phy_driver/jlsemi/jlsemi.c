@@ -58,6 +58,7 @@ static int jl1xxx_probe(struct phy_device *phydev)
 		return -ENOMEM;
 
 	phydev->priv = jl1xxx;
+	jlsemi_invalidate_cache(phydev);
 
 #if (JLSEMI_KERNEL_DEVICE_TREE_USE)
 	if (!dev->of_node)
@@ -67,19 +68,40 @@ static int jl1xxx_probe(struct phy_device *phydev)
 	if (err < 0)
 		return err;
 
-	if (jl1xxx->intr.enable & JL1XXX_INTR_STATIC_OP_EN)
-		phydev->irq = JL1XXX_INTR_IRQ;
+	err = jl1xxx_script_compile(phydev);
+	if (err < 0)
+		return err;
+
+	jlsemi_irq_setup(phydev, jl1xxx->intr.enable & JL1XXX_INTR_STATIC_OP_EN,
+			 JL1XXX_INTR_IRQ);
 
 	jl1xxx->static_inited = false;
+	err = jlsemi_stats_init(&jl1xxx->stats, jl1xxx_hw_stats,
+				ARRAY_SIZE(jl1xxx_hw_stats));
+	if (err < 0)
+		return err;
+
+	err = jl1xxx_intr_line_attach(phydev);
+	if (err < 0) {
+		jlsemi_stats_free(&jl1xxx->stats);
+		return err;
+	}
+
+	jlsemi_debugfs_init(phydev);
+	jlsemi_intr_debugfs_init(phydev, &jl1xxx->intr);
+	jlsemi_stats_debugfs_init(phydev, &jl1xxx->stats);
 
 	return 0;
 }
 
-static int jl1xxx_config_init(struct phy_device *phydev)
+static int __jl1xxx_config_init(struct phy_device *phydev)
 {
 	struct jl1xxx_priv *priv = phydev->priv;
 	int ret;
 
+	/* The page may have been switched while detached */
+	jlsemi_invalidate_cache(phydev);
+
 	if (!priv->static_inited) {
 #if (JLSEMI_DEBUG_INFO)
 		JLSEMI_PHY_MSG("jl1xxx_config_init_before:\n");
@@ -99,9 +121,24 @@ static int jl1xxx_config_init(struct phy_device *phydev)
 		priv->static_inited = JLSEMI_PHY_NOT_REENTRANT;
 	}
 
+	/* The registers may have changed across the reset */
+	jlsemi_stats_start(phydev, &priv->stats);
+
 	return 0;
 }
 
+static int jl1xxx_config_init(struct phy_device *phydev)
+{
+	int acct;
+	int err;
+
+	acct = jlsemi_acct_begin(phydev, JLSEMI_ACCT_CONFIG_INIT);
+	err = __jl1xxx_config_init(phydev);
+	jlsemi_acct_end(phydev, acct);
+
+	return err;
+}
+
 static int jl1xxx_ack_interrupt(struct phy_device *phydev)
 {
 	int err;
@@ -118,40 +155,97 @@ static int jl1xxx_config_intr(struct phy_device *phydev)
 	struct jl1xxx_priv *priv = phydev->priv;
 	int err;
 
-	if (priv->intr.enable & JL1XXX_INTR_STATIC_OP_EN) {
+	if (!(priv->intr.enable & JL1XXX_INTR_STATIC_OP_EN))
+		return 0;
+
+	if (phydev->interrupts == PHY_INTERRUPT_ENABLED) {
 		err = jl1xxx_ack_interrupt(phydev);
 		if (err < 0)
 			return err;
 
-		err = jl1xxx_intr_static_op_set(phydev);
-		if (err < 0)
-			return err;
+		return jl1xxx_intr_static_op_set(phydev);
 	}
 
-	return 0;
+	/* A storm must not enable the sources again behind us */
+	jlsemi_intr_storm_stop(&priv->intr, false);
+	err = jl1xxx_intr_disable(phydev);
+	if (err < 0)
+		return err;
+
+	return jl1xxx_ack_interrupt(phydev);
 }
 
-static int jl1xxx_read_status(struct phy_device *phydev)
+#if (JLSEMI_PHY_HANDLE_INTR)
+static irqreturn_t jl1xxx_handle_interrupt(struct phy_device *phydev)
 {
+	struct jl1xxx_priv *priv = phydev->priv;
+	int status;
+
+	status = jl1xxx_intr_ack_event(phydev);
+	if (status < 0) {
+		phy_error(phydev);
+		return IRQ_NONE;
+	}
+
+	status &= priv->intr.mask;
+	if (!status)
+		return IRQ_NONE;
+
+	jlsemi_intr_account(&priv->intr, status);
+	if (status & priv->intr.link)
+		phy_trigger_machine(phydev);
+
+	return IRQ_HANDLED;
+}
+#endif
+
+static int __jl1xxx_read_status(struct phy_device *phydev)
+{
+#if !(JLSEMI_PHY_HANDLE_INTR)
 	struct jl1xxx_priv *priv = phydev->priv;
 	int err;
 
+	/* The irq handler acks the event on newer kernels */
 	if (priv->intr.enable & JL1XXX_INTR_STATIC_OP_EN) {
 		err = jl1xxx_ack_interrupt(phydev);
 		if (err < 0)
 			return err;
 	}
+#endif
 
 	return genphy_read_status(phydev);
 }
 
+static int jl1xxx_read_status(struct phy_device *phydev)
+{
+	struct jl1xxx_priv *priv = phydev->priv;
+	int acct;
+	int err;
+
+	acct = jlsemi_acct_begin(phydev, JLSEMI_ACCT_READ_STATUS);
+	err = __jl1xxx_read_status(phydev);
+	jlsemi_acct_end(phydev, acct);
+	if (err < 0)
+		return err;
+
+	jlsemi_stats_link(&priv->stats, phydev->link);
+
+	return err;
+}
+
 static void jl1xxx_remove(struct phy_device *phydev)
 {
 	struct device *dev = jlsemi_get_mdio(phydev);
 	struct jl1xxx_priv *priv = phydev->priv;
 
-	if (priv)
-		devm_kfree(dev, priv);
+	if (!priv)
+		return;
+
+	jlsemi_debugfs_exit(phydev);
+	jlsemi_intr_line_detach(&priv->intr);
+	jlsemi_intr_storm_cancel(&priv->intr);
+	jlsemi_stats_free(&priv->stats);
+	devm_kfree(dev, priv);
 }
 
 #if (JLSEMI_PHY_WOL)
@@ -192,12 +286,43 @@ static int jl1xxx_set_wol(struct phy_device *phydev,
 
 static int jl1xxx_suspend(struct phy_device *phydev)
 {
+	struct jl1xxx_priv *priv = phydev->priv;
+	int err;
+
+	jlsemi_stats_stop(&priv->stats);
+	/* Saved with the configured sources, no poll while suspended */
+	jlsemi_intr_storm_stop(&priv->intr, true);
+	err = jlsemi_script_save(phydev, &priv->core.script);
+	if (err < 0)
+		return err;
+
 	return genphy_suspend(phydev);
 }
 
 static int jl1xxx_resume(struct phy_device *phydev)
 {
-	return genphy_resume(phydev);
+	struct jl1xxx_priv *priv = phydev->priv;
+	int err;
+
+	jlsemi_invalidate_cache(phydev);
+
+	err = genphy_resume(phydev);
+	if (err < 0)
+		return err;
+
+	/* Count the wake-up that brought us back, if any */
+	err = jl1xxx_wol_event_clear(phydev);
+	if (err < 0)
+		return err;
+
+	/* Only what was lost while suspended is written back */
+	err = jlsemi_script_restore(phydev, &priv->core.script);
+	if (err < 0)
+		return err;
+
+	jlsemi_stats_start(phydev, &priv->stats);
+
+	return 0;
 }
 
 static int jl2xxx_probe(struct phy_device *phydev)
@@ -211,6 +336,7 @@ static int jl2xxx_probe(struct phy_device *phydev)
 		return -ENOMEM;
 
 	phydev->priv = jl2xxx;
+	jlsemi_invalidate_cache(phydev);
 
 #if (JLSEMI_KERNEL_DEVICE_TREE_USE)
 	if (!dev->of_node)
@@ -220,24 +346,55 @@ static int jl2xxx_probe(struct phy_device *phydev)
 	if (err < 0)
 		return err;
 
-	if (jl2xxx->intr.enable & JL2XXX_INTR_STATIC_OP_EN)
-		phydev->irq = JL2XXX_INTR_IRQ;
+	err = jl2xxx_script_compile(phydev);
+	if (err < 0)
+		return err;
+
+	jlsemi_irq_setup(phydev, jl2xxx->intr.enable & JL2XXX_INTR_STATIC_OP_EN,
+			 JL2XXX_INTR_IRQ);
+
+	jl2xxx->work_mode.cur = JL2XXX_WORK_MODE_UNKNOWN;
+	err = jl2xxx_work_mode_get(phydev);
+	if (err < 0)
+		return err;
 
 	jl2xxx->static_inited = false;
-	jl2xxx->nstats = ARRAY_SIZE(jl2xxx_hw_stats);
-	jl2xxx->hw_stats = jl2xxx_hw_stats;
-	jl2xxx->stats = kcalloc(jl2xxx->nstats, sizeof(u64), GFP_KERNEL);
-	if (!jl2xxx->stats)
-		return -ENOMEM;
+	err = jlsemi_stats_init(&jl2xxx->stats, jl2xxx_hw_stats,
+				ARRAY_SIZE(jl2xxx_hw_stats));
+	if (err < 0)
+		return err;
+
+	err = jl2xxx_patch_fw_request(phydev);
+	if (err < 0)
+		goto err_stats;
+
+	err = jl2xxx_intr_line_attach(phydev);
+	if (err < 0)
+		goto err_patch;
+
+	jlsemi_debugfs_init(phydev);
+	jlsemi_intr_debugfs_init(phydev, &jl2xxx->intr);
+	jlsemi_stats_debugfs_init(phydev, &jl2xxx->stats);
 
 	return 0;
+
+err_patch:
+	/* Waits for the firmware callback, which writes to priv */
+	jl2xxx_patch_release(phydev);
+err_stats:
+	jlsemi_stats_free(&jl2xxx->stats);
+
+	return err;
 }
 
-static int jl2xxx_config_init(struct phy_device *phydev)
+static int __jl2xxx_config_init(struct phy_device *phydev)
 {
 	struct jl2xxx_priv *priv = phydev->priv;
 	int ret;
 
+	/* The page may have been switched while detached */
+	jlsemi_invalidate_cache(phydev);
+
 	if (!priv->static_inited) {
 #if (JLSEMI_DEBUG_INFO)
 		JLSEMI_PHY_MSG("jl2xxx_config_init_before:\n");
@@ -245,7 +402,10 @@ static int jl2xxx_config_init(struct phy_device *phydev)
 		if (ret < 0)
 			return ret;
 #endif
-		ret = jl2xxx_static_op_init(phydev);
+		if (priv->async_init.enable & JL2XXX_ASYNC_INIT_STATIC_OP_EN)
+			ret = jl2xxx_async_init_start(phydev);
+		else
+			ret = jl2xxx_static_op_init(phydev);
 		if (ret < 0)
 			return ret;
 #if (JLSEMI_DEBUG_INFO)
@@ -257,9 +417,27 @@ static int jl2xxx_config_init(struct phy_device *phydev)
 		priv->static_inited = JLSEMI_PHY_NOT_REENTRANT;
 	}
 
+	/* The registers may have changed across the reset, an asynchronous
+	 * init patches the phy again and reads them itself
+	 */
+	if (jl2xxx_async_init_status(phydev))
+		jlsemi_stats_start(phydev, &priv->stats);
+
 	return 0;
 }
 
+static int jl2xxx_config_init(struct phy_device *phydev)
+{
+	int acct;
+	int err;
+
+	acct = jlsemi_acct_begin(phydev, JLSEMI_ACCT_CONFIG_INIT);
+	err = __jl2xxx_config_init(phydev);
+	jlsemi_acct_end(phydev, acct);
+
+	return err;
+}
+
 static int jl2xxx_ack_interrupt(struct phy_device *phydev)
 {
 	int err;
@@ -276,25 +454,95 @@ static int jl2xxx_config_intr(struct phy_device *phydev)
 	struct jl2xxx_priv *priv = phydev->priv;
 	int err;
 
-	if (priv->intr.enable & JL2XXX_INTR_STATIC_OP_EN) {
+	if (!(priv->intr.enable & JL2XXX_INTR_STATIC_OP_EN))
+		return 0;
+
+	if (phydev->interrupts == PHY_INTERRUPT_ENABLED) {
 		err = jl2xxx_ack_interrupt(phydev);
 		if (err < 0)
 			return err;
 
-		err = jl2xxx_intr_static_op_set(phydev);
-		if (err < 0)
-			return err;
+		return jl2xxx_intr_static_op_set(phydev);
 	}
 
-	return 0;
+	/* A storm must not enable the sources again behind us */
+	jlsemi_intr_storm_stop(&priv->intr, false);
+	err = jl2xxx_intr_disable(phydev);
+	if (err < 0)
+		return err;
+
+	return jl2xxx_ack_interrupt(phydev);
 }
 
-static int jl2xxx_read_status(struct phy_device *phydev)
+#if (JLSEMI_PHY_HANDLE_INTR)
+static irqreturn_t jl2xxx_handle_interrupt(struct phy_device *phydev)
+{
+	struct jl2xxx_priv *priv = phydev->priv;
+	int status;
+
+	status = jl2xxx_intr_ack_event(phydev);
+	if (status < 0) {
+		phy_error(phydev);
+		return IRQ_NONE;
+	}
+
+	status &= priv->intr.mask;
+	if (!status)
+		return IRQ_NONE;
+
+	jlsemi_intr_account(&priv->intr, status);
+	if (status & priv->intr.link)
+		phy_trigger_machine(phydev);
+
+	return IRQ_HANDLED;
+}
+#endif
+
+static int jl2xxx_config_aneg(struct phy_device *phydev)
+{
+	struct jl2xxx_priv *priv = phydev->priv;
+	int phy_mode;
+	int val;
+
+	/* Started by read_status once the asynchronous init has finished */
+	val = jl2xxx_async_init_status(phydev);
+	if (val == 0)
+		priv->async_init.aneg = true;
+	if (val <= 0)
+		return val;
+	priv->async_init.aneg = false;
+
+	phy_mode = jl2xxx_work_mode_get(phydev);
+	if (phy_mode < 0)
+		return phy_mode;
+
+	if (((phy_mode == JL2XXX_FIBER_RGMII_MODE) ||
+	    (phy_mode == JL2XXX_UTP_FIBER_RGMII_MODE)))
+		return jl2xxx_config_aneg_fiber(phydev);
+
+	return genphy_config_aneg(phydev);
+}
+
+static int __jl2xxx_read_status(struct phy_device *phydev)
 {
 	struct jl2xxx_priv *priv = phydev->priv;
 	bool fiber_mode;
 	int err;
 
+	/* Report the link as down until the static init has finished */
+	err = jl2xxx_async_init_status(phydev);
+	if (err <= 0) {
+		phydev->link = 0;
+		return err;
+	}
+
+	/* Autoneg asked for while the init was running */
+	if (priv->async_init.aneg) {
+		err = jl2xxx_config_aneg(phydev);
+		if (err < 0)
+			return err;
+	}
+
 	if ((!priv->rxc_out.inited) &&
 	   (priv->rxc_out.enable & JL2XXX_RXC_OUT_STATIC_OP_EN) &&
 	   (priv->work_mode.mode == JL2XXX_MAC_SGMII_RGMII_MODE)) {
@@ -304,6 +552,7 @@ static int jl2xxx_read_status(struct phy_device *phydev)
 					      priv->work_mode.mode);
 		if (err < 0)
 			return err;
+		priv->work_mode.cur = priv->work_mode.mode;
 
 		err = jlsemi_soft_reset(phydev);
 		if (err < 0)
@@ -311,11 +560,14 @@ static int jl2xxx_read_status(struct phy_device *phydev)
 		priv->rxc_out.inited = true;
 	}
 
+#if !(JLSEMI_PHY_HANDLE_INTR)
+	/* The irq handler acks the event on newer kernels */
 	if (priv->intr.enable & JL2XXX_INTR_STATIC_OP_EN) {
 		err = jl2xxx_ack_interrupt(phydev);
 		if (err < 0)
 			return err;
 	}
+#endif
 
 	fiber_mode = jl2xxx_read_fiber_status(phydev);
 	if (fiber_mode)
@@ -324,30 +576,44 @@ static int jl2xxx_read_status(struct phy_device *phydev)
 	return genphy_read_status(phydev);
 }
 
-static int jl1xxx_config_aneg(struct phy_device *phydev)
+static int jl2xxx_read_status(struct phy_device *phydev)
 {
-	return genphy_config_aneg(phydev);
-}
+	struct jl2xxx_priv *priv = phydev->priv;
+	int acct;
+	int err;
 
-static int jl2xxx_config_aneg(struct phy_device *phydev)
-{
-	u16 phy_mode;
-	int val;
+	acct = jlsemi_acct_begin(phydev, JLSEMI_ACCT_READ_STATUS);
+	err = __jl2xxx_read_status(phydev);
+	jlsemi_acct_end(phydev, acct);
+	if (err < 0)
+		return err;
 
-	val = jlsemi_read_paged(phydev, JL2XXX_PAGE18,
-				JL2XXX_WORK_MODE_REG);
-	phy_mode = val & JL2XXX_WORK_MODE_MASK;
+	jlsemi_stats_link(&priv->stats, phydev->link);
 
-	if (((phy_mode == JL2XXX_FIBER_RGMII_MODE) ||
-	    (phy_mode == JL2XXX_UTP_FIBER_RGMII_MODE)))
-		return jl2xxx_config_aneg_fiber(phydev);
+	return err;
+}
 
+static int jl1xxx_config_aneg(struct phy_device *phydev)
+{
 	return genphy_config_aneg(phydev);
 }
 
 static int jl2xxx_suspend(struct phy_device *phydev)
 {
 	struct jl2xxx_priv *priv = phydev->priv;
+	int err;
+
+	/* The init restarts the statistics when it is done */
+	jl2xxx_async_init_flush(phydev);
+	jlsemi_stats_stop(&priv->stats);
+	/* Power may be removed while suspended */
+	jl2xxx_patch_forget(phydev);
+	/* Saved with the configured sources, no poll while suspended */
+	jlsemi_intr_storm_stop(&priv->intr, true);
+
+	err = jlsemi_script_save(phydev, &priv->core.script);
+	if (err < 0)
+		return err;
 
 	/* clear wol event */
 	if (priv->wol.enable & JL2XXX_WOL_STATIC_OP_EN) {
@@ -361,7 +627,40 @@ static int jl2xxx_suspend(struct phy_device *phydev)
 
 static int jl2xxx_resume(struct phy_device *phydev)
 {
-	return genphy_resume(phydev);
+	struct jl2xxx_priv *priv = phydev->priv;
+	int err;
+
+	jlsemi_invalidate_cache(phydev);
+	/* The straps apply again if power was lost */
+	jl2xxx_work_mode_forget(phydev);
+
+	err = genphy_resume(phydev);
+	if (err < 0)
+		return err;
+
+	/* An init from config_init is still pending, it writes it all */
+	if (!jl2xxx_async_init_status(phydev))
+		return 0;
+
+	/* Without power the phy needs the full static init again */
+	err = jl2xxx_patch_lost(phydev);
+	if (err < 0)
+		return err;
+	if (err) {
+		/* The work restarts the statistics when it is done */
+		if (priv->async_init.enable & JL2XXX_ASYNC_INIT_STATIC_OP_EN)
+			return jl2xxx_async_init_start(phydev);
+		err = jl2xxx_static_op_init(phydev);
+	} else {
+		/* Only what was lost while suspended is written back */
+		err = jlsemi_script_restore(phydev, &priv->core.script);
+	}
+	if (err < 0)
+		return err;
+
+	jlsemi_stats_start(phydev, &priv->stats);
+
+	return 0;
 }
 
 #if (JLSEMI_PHY_WOL)
@@ -449,34 +748,64 @@ static int jl2xxx_set_tunable(struct phy_device *phydev,
 }
 #endif
 
+#if (JL1XXX_GET_STAT)
+static int jl1xxx_get_sset_count(struct phy_device *phydev)
+{
+	struct jl1xxx_priv *priv = phydev->priv;
+
+	if (!priv)
+		return 0;
+
+	return priv->stats.count;
+}
+
+static void jl1xxx_get_stats(struct phy_device *phydev,
+			    struct ethtool_stats *stats, u64 *data)
+{
+	struct jl1xxx_priv *priv = phydev->priv;
+
+	if (!priv)
+		return;
+
+	jlsemi_stats_copy(&priv->stats, data);
+}
+#endif
+
+#if (JL1XXX_GET_STRING)
+static void jl1xxx_get_strings(struct phy_device *phydev, u8 *data)
+{
+	struct jl1xxx_priv *priv = phydev->priv;
+	int i;
+
+	if (!priv)
+		return;
+
+	for (i = 0; i < priv->stats.count; i++)
+		strlcpy(data + i * ETH_GSTRING_LEN,
+			priv->stats.hw[i].string, ETH_GSTRING_LEN);
+}
+#endif
+
 #if (JL2XXX_GET_STAT)
-static u64 get_stat(struct phy_device *phydev, int i)
+static int jl2xxx_get_sset_count(struct phy_device *phydev)
 {
 	struct jl2xxx_priv *priv = phydev->priv;
-	int val;
-
-	val = jlsemi_read_paged(phydev, priv->hw_stats[i].page,
-				priv->hw_stats[i].reg);
-	if (val < 0)
-		return U64_MAX;
 
-	val = val & priv->hw_stats[i].mask;
-	priv->stats[i] += val;
+	if (!priv)
+		return 0;
 
-	return priv->stats[i];
+	return priv->stats.count;
 }
 
 static void jl2xxx_get_stats(struct phy_device *phydev,
 			    struct ethtool_stats *stats, u64 *data)
 {
 	struct jl2xxx_priv *priv = phydev->priv;
-	int i;
 
 	if (!priv)
 		return;
 
-	for (i = 0; i < priv->nstats; i++)
-		data[i] = get_stat(phydev, i);
+	jlsemi_stats_copy(&priv->stats, data);
 }
 #endif
 
@@ -489,9 +818,9 @@ static void jl2xxx_get_strings(struct phy_device *phydev, u8 *data)
 	if (!priv)
 		return;
 
-	for (i = 0; i < priv->nstats; i++)
+	for (i = 0; i < priv->stats.count; i++)
 		strlcpy(data + i * ETH_GSTRING_LEN,
-			priv->hw_stats[i].string, ETH_GSTRING_LEN);
+			priv->stats.hw[i].string, ETH_GSTRING_LEN);
 }
 #endif
 
@@ -500,26 +829,42 @@ static void jl2xxx_remove(struct phy_device *phydev)
 	struct device *dev = jlsemi_get_mdio(phydev);
 	struct jl2xxx_priv *priv = phydev->priv;
 
-	kfree(priv->stats);
-	if (priv)
-		devm_kfree(dev, priv);
+	if (!priv)
+		return;
+
+	jlsemi_debugfs_exit(phydev);
+	jlsemi_intr_line_detach(&priv->intr);
+	jlsemi_intr_storm_cancel(&priv->intr);
+	jl2xxx_async_init_cancel(phydev);
+	jl2xxx_patch_release(phydev);
+	jlsemi_stats_free(&priv->stats);
+	devm_kfree(dev, priv);
 }
 
 static inline int jlsemi_aneg_done(struct phy_device *phydev)
 {
-	int retval = phy_read(phydev, MII_BMSR);
+	int retval;
+	int acct;
+
+	acct = jlsemi_acct_begin(phydev, JLSEMI_ACCT_ANEG_DONE);
+	retval = jlsemi_read(phydev, MII_BMSR);
+	jlsemi_acct_end(phydev, acct);
 
 	return (retval < 0) ? retval : (retval & BMSR_ANEGCOMPLETE);
 }
 
 static int jl2xxx_aneg_done(struct phy_device *phydev)
 {
-	u16 phy_mode;
+	int phy_mode;
 	int val;
 
-	val = jlsemi_read_paged(phydev, JL2XXX_PAGE18,
-				JL2XXX_WORK_MODE_REG);
-	phy_mode = val & JL2XXX_WORK_MODE_MASK;
+	val = jl2xxx_async_init_status(phydev);
+	if (val <= 0)
+		return val;
+
+	phy_mode = jl2xxx_work_mode_get(phydev);
+	if (phy_mode < 0)
+		return phy_mode;
 
 	// fiber not an complite
 	if (((phy_mode == JL2XXX_FIBER_RGMII_MODE) ||
@@ -539,6 +884,11 @@ static struct phy_driver jlsemi_drivers[] = {
 		.features	= PHY_BASIC_FEATURES,
 		.probe		= jl1xxx_probe,
 		.config_intr	= jl1xxx_config_intr,
+#if (JLSEMI_PHY_HANDLE_INTR)
+		.handle_interrupt = jl1xxx_handle_interrupt,
+#else
+		.ack_interrupt	= jl1xxx_ack_interrupt,
+#endif
 		.read_status	= jl1xxx_read_status,
 		.config_init    = jl1xxx_config_init,
 		.config_aneg    = jl1xxx_config_aneg,
@@ -549,6 +899,13 @@ static struct phy_driver jlsemi_drivers[] = {
 #if (JLSEMI_PHY_WOL)
 		.get_wol	= jl1xxx_get_wol,
 		.set_wol	= jl1xxx_set_wol,
+#endif
+#if (JL1XXX_GET_STAT)
+		.get_sset_count	= jl1xxx_get_sset_count,
+		.get_stats	= jl1xxx_get_stats,
+#endif
+#if (JL1XXX_GET_STRING)
+		.get_strings	= jl1xxx_get_strings,
 #endif
 	},
 	{
@@ -559,6 +916,11 @@ static struct phy_driver jlsemi_drivers[] = {
 		.features	= PHY_GBIT_FEATURES,
 		.probe		= jl2xxx_probe,
 		.config_intr	= jl2xxx_config_intr,
+#if (JLSEMI_PHY_HANDLE_INTR)
+		.handle_interrupt = jl2xxx_handle_interrupt,
+#else
+		.ack_interrupt	= jl2xxx_ack_interrupt,
+#endif
 		.read_status	= jl2xxx_read_status,
 		.config_init    = jl2xxx_config_init,
 		.config_aneg    = jl2xxx_config_aneg,
@@ -575,6 +937,7 @@ static struct phy_driver jlsemi_drivers[] = {
 		.set_tunable	= jl2xxx_set_tunable,
 #endif
 #if (JL2XXX_GET_STAT)
+		.get_sset_count	= jl2xxx_get_sset_count,
 		.get_stats	= jl2xxx_get_stats,
 #endif
 #if (JL2XXX_GET_STRING)
@@ -0,0 +1,132 @@
+#!/usr/bin/env python3
+# SPDX-License-Identifier: GPL-2.0
+#
+# JL2xxx patch tool
+#
+#   jlpatch.py encode raw.txt			raw words -> compact C array
+#   jlpatch.py decode jlsemi-core.c N		compact init_dataN -> raw words
+#   jlpatch.py pack jlsemi-core.c out.bin	built-in tables -> firmware file
+#
+# Raw words are the vendor format, 0x00RRVVVV: register RR gets value VVVV.
+# The compact stream is a list of runs, each a header word
+# (first register << 8 | number of values) followed by the values for
+# consecutive registers. See JL2XXX_PATCH_RUN() in jlsemi-core.h.
+#
+# The packed file goes to /lib/firmware/jlsemi/jl2xxx-patch.bin on the
+# target, see JL2XXX_PATCH_FW_NAME in jlsemi-dt-phy.h and
+# struct jl_patch_fw_header in jlsemi-core.h for the layout.
+
+import re
+import struct
+import sys
+
+USAGE = 'usage: jlpatch.py encode raw.txt | decode core.c N | pack core.c out'
+
+MAGIC = 0x46504c4a
+FORMAT = 2
+INFO_MAX = 4
+CHECK_PLAIN = 0
+CHECK_ZTE = 1
+RUN_MAX = 0xff
+
+
+def encode(words):
+    out = []
+    i = 0
+    while i < len(words):
+        reg = (words[i] >> 16) & 0xff
+        j = i + 1
+        while (j < len(words) and j - i < RUN_MAX and
+               (words[j] >> 16) & 0xff == reg + j - i):
+            j += 1
+        out.append(reg << 8 | (j - i))
+        out.extend(w & 0xffff for w in words[i:j])
+        i = j
+    return out
+
+
+def decode(stream):
+    words = []
+    i = 0
+    while i < len(stream):
+        reg, count = stream[i] >> 8, stream[i] & 0xff
+        if count == 0 or i + count >= len(stream):
+            sys.exit('bad run at word %d' % i)
+        for j in range(count):
+            words.append((reg + j) << 16 | stream[i + 1 + j])
+        i += count + 1
+    return words
+
+
+def numbers(text):
+    return [int(v, 0) for v in re.findall(r'0x[0-9a-fA-F]+|\b\d+\b', text)]
+
+
+def array(src, name):
+    m = re.search(r'\b%s\[\]\s*=\s*\{(.*?)\};' % name, src, re.S)
+    if not m:
+        sys.exit('%s not found' % name)
+    return numbers(m.group(1))
+
+
+def scalar(src, name):
+    m = re.search(r'\b%s\s*=\s*(0x[0-9a-fA-F]+|\d+)\s*;' % name, src)
+    return int(m.group(1), 0) if m else 0
+
+
+def c_array(stream):
+    lines = []
+    for i in range(0, len(stream), 8):
+        lines.append('\t' + ' '.join('0x%04x,' % v for v in stream[i:i + 8]))
+    return '\n'.join(lines)
+
+
+def entries(src):
+    table = re.search(r'phy_patches\[\]\s*=\s*\{(.*?)\n\};', src, re.S)
+    if not table:
+        sys.exit('phy_patches not found')
+    for body in re.findall(r'\{\s*\.data(.*?)\.verify', table.group(1), re.S):
+        data = re.search(r'init_data(\d+)', body).group(1)
+        info = re.search(r'patch_fw_versions(\d+)', body).group(1)
+        version = re.search(r'\.version\s*=\s*(\w+)', body).group(1)
+        check = CHECK_ZTE if 'zte_check' in body else CHECK_PLAIN
+        yield data, info, version, check
+
+
+def pack(src, path):
+    blobs = []
+    for data, info, version, check in entries(src):
+        stream = array(src, 'init_data' + data)
+        decode(stream)
+        fw = array(src, 'patch_fw_versions' + info)
+        if len(fw) > INFO_MAX:
+            sys.exit('patch_fw_versions%s has too many entries' % info)
+        ver = int(version, 0) if version[0].isdigit() else scalar(src, version)
+        blob = struct.pack('<HHH', ver, check, len(fw))
+        blob += struct.pack('<%dH' % INFO_MAX,
+                            *(fw + [0] * (INFO_MAX - len(fw))))
+        blob += struct.pack('<I', len(stream))
+        blob += struct.pack('<%dH' % len(stream), *stream)
+        blobs.append(blob)
+
+    with open(path, 'wb') as out:
+        out.write(struct.pack('<IHH', MAGIC, FORMAT, len(blobs)))
+        for blob in blobs:
+            out.write(blob)
+
+
+def main():
+    if len(sys.argv) == 3 and sys.argv[1] == 'encode':
+        print(c_array(encode(numbers(open(sys.argv[2]).read()))))
+    elif len(sys.argv) == 4 and sys.argv[1] == 'decode':
+        src = open(sys.argv[2]).read()
+        for w in decode(array(src, 'init_data' + sys.argv[3])):
+            print('0x%06x' % w)
+    elif len(sys.argv) == 4 and sys.argv[1] == 'pack':
+        pack(open(sys.argv[2]).read(), sys.argv[3])
+    else:
+        sys.exit(USAGE)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,171 @@
+// SPDX-License-Identifier: GPL-2.0
+/*
+ * Userspace harness for the JL2xxx patch stream decoder
+ *
+ * Compares the compact run decoder in jl2xxx_patch_load() against the
+ * old loop over raw u32 words: both must issue the same register writes,
+ * and the time per pass is reported for each.
+ *
+ *   cc -O2 -o patch_bench patch_bench.c
+ *   ./jlpatch.py decode ../../source/phy_driver/jlsemi/jlsemi-core.c 0 > raw
+ *   ./patch_bench raw
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define RUN_REG(hdr)	((hdr) >> 8)
+#define RUN_LEN(hdr)	((hdr) & 0xff)
+#define RUN_MAX		0xff
+#define PASSES		20000
+
+struct bus {
+	uint32_t *log;
+	size_t n;
+};
+
+static void phy_write(struct bus *bus, uint32_t reg, uint16_t val)
+{
+	bus->log[bus->n++] = reg << 16 | val;
+}
+
+static int phy_read(struct bus *bus, uint32_t reg)
+{
+	(void)bus;
+	(void)reg;
+	return 0;
+}
+
+static void patch_write(struct bus *bus, uint32_t reg, uint16_t val)
+{
+	int i;
+
+	phy_write(bus, reg, val);
+	if (reg == 0x18) {
+		phy_write(bus, 0x10, 0x8006);
+		for (i = 0; i < 8; i++)
+			if (phy_read(bus, 0x10) == 0)
+				break;
+	}
+}
+
+/* The loop jl2xxx_patch_load() used before the compact encoding */
+static void load_raw(struct bus *bus, const uint32_t *data, size_t len)
+{
+	size_t i;
+
+	for (i = 0; i < len; i++)
+		patch_write(bus, (data[i] >> 16) & 0xff, data[i] & 0xffff);
+}
+
+/* Same as jl2xxx_patch_load() */
+static int load_runs(struct bus *bus, const uint16_t *data, size_t len)
+{
+	const uint16_t *end = data + len;
+	uint32_t reg;
+	int count;
+
+	while (data < end) {
+		reg = RUN_REG(*data);
+		count = RUN_LEN(*data++);
+		if (count > end - data)
+			return -1;
+		while (count--)
+			patch_write(bus, reg++, *data++);
+	}
+
+	return 0;
+}
+
+static size_t encode(const uint32_t *raw, size_t len, uint16_t *out)
+{
+	size_t i = 0, j, n = 0;
+	uint32_t reg;
+
+	while (i < len) {
+		reg = (raw[i] >> 16) & 0xff;
+		for (j = i + 1; j < len && j - i < RUN_MAX; j++)
+			if (((raw[j] >> 16) & 0xff) != reg + j - i)
+				break;
+		out[n++] = reg << 8 | (j - i);
+		for (; i < j; i++)
+			out[n++] = raw[i] & 0xffff;
+	}
+
+	return n;
+}
+
+static double now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main(int argc, char **argv)
+{
+	struct bus a = { 0 }, b = { 0 };
+	uint32_t *raw = NULL;
+	size_t len = 0, cap = 0, enc_len;
+	unsigned long v;
+	uint16_t *enc;
+	double t0, t_raw, t_enc;
+	FILE *f;
+	int i;
+
+	if (argc != 2) {
+		fprintf(stderr, "usage: %s raw-words\n", argv[0]);
+		return 2;
+	}
+
+	f = fopen(argv[1], "r");
+	if (!f) {
+		perror(argv[1]);
+		return 2;
+	}
+	while (fscanf(f, "%lx", &v) == 1) {
+		if (len == cap) {
+			cap = cap ? cap * 2 : 1024;
+			raw = realloc(raw, cap * sizeof(*raw));
+		}
+		raw[len++] = v;
+	}
+	fclose(f);
+
+	enc = malloc(2 * len * sizeof(*enc));
+	enc_len = encode(raw, len, enc);
+	a.log = malloc(2 * len * sizeof(*a.log));
+	b.log = malloc(2 * len * sizeof(*b.log));
+
+	load_raw(&a, raw, len);
+	if (load_runs(&b, enc, enc_len) || a.n != b.n ||
+	    memcmp(a.log, b.log, a.n * sizeof(*a.log))) {
+		fprintf(stderr, "decoded writes differ\n");
+		return 1;
+	}
+
+	t0 = now();
+	for (i = 0; i < PASSES; i++) {
+		a.n = 0;
+		load_raw(&a, raw, len);
+	}
+	t_raw = (now() - t0) / PASSES;
+
+	t0 = now();
+	for (i = 0; i < PASSES; i++) {
+		b.n = 0;
+		load_runs(&b, enc, enc_len);
+	}
+	t_enc = (now() - t0) / PASSES;
+
+	printf("words %zu, raw %zu bytes, runs %zu bytes (%.0f%%)\n",
+	       len, len * sizeof(*raw), enc_len * sizeof(*enc),
+	       100.0 * enc_len * sizeof(*enc) / (len * sizeof(*raw)));
+	printf("raw loop %.2f us/pass, run decoder %.2f us/pass\n",
+	       t_raw * 1e6, t_enc * 1e6);
+
+	return 0;
+}